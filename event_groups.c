@@ -47,7 +47,12 @@
 /* The following bit fields convey control information in a task's event list
  * item value.  It is important they don't clash with the
  * taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
-#if configUSE_16_BIT_TICKS == 1
+#if configEVENT_GROUP_64BIT == 1
+    #define eventCLEAR_EVENTS_ON_EXIT_BIT    0x0100000000000000ULL
+    #define eventUNBLOCKED_DUE_TO_BIT_SET    0x0200000000000000ULL
+    #define eventWAIT_FOR_ALL_BITS           0x0400000000000000ULL
+    #define eventEVENT_BITS_CONTROL_BYTES    0xff00000000000000ULL
+#elif configUSE_16_BIT_TICKS == 1
     #define eventCLEAR_EVENTS_ON_EXIT_BIT    0x0100U
     #define eventUNBLOCKED_DUE_TO_BIT_SET    0x0200U
     #define eventWAIT_FOR_ALL_BITS           0x0400U
@@ -59,10 +64,43 @@
     #define eventEVENT_BITS_CONTROL_BYTES    0xff000000UL
 #endif
 
+/* 64 bit event bits do not fit in a task's event list item value, so when
+ * configEVENT_GROUP_64BIT is 1 the value is held in the task's TCB instead. */
+#if configEVENT_GROUP_64BIT == 1
+    #define eventPLACE_ON_EVENT_LIST( pxEventList, uxItemValue, xTicksToWait )      vTaskPlaceOnUnorderedEventList64( ( pxEventList ), ( uxItemValue ), ( xTicksToWait ) )
+    #define eventREMOVE_FROM_EVENT_LIST( pxEventListItem, uxItemValue )             vTaskRemoveFromUnorderedEventList64( ( pxEventListItem ), ( uxItemValue ) )
+    #define eventGET_EVENT_ITEM_VALUE( pxEventListItem )                            ullTaskGetEventItemValue64( pxEventListItem )
+    #define eventRESET_EVENT_ITEM_VALUE()                                           ullTaskResetEventItemValue64()
+    #define eventREMOVE_FROM_EVENT_LIST_FROM_ISR( pxEventListItem, uxItemValue )    xTaskRemoveFromUnorderedEventListFromISR64( ( pxEventListItem ), ( uxItemValue ) )
+#else
+    #define eventPLACE_ON_EVENT_LIST( pxEventList, uxItemValue, xTicksToWait )      vTaskPlaceOnUnorderedEventList( ( pxEventList ), ( uxItemValue ), ( xTicksToWait ) )
+    #define eventREMOVE_FROM_EVENT_LIST( pxEventListItem, uxItemValue )             vTaskRemoveFromUnorderedEventList( ( pxEventListItem ), ( uxItemValue ) )
+    #define eventGET_EVENT_ITEM_VALUE( pxEventListItem )                            listGET_LIST_ITEM_VALUE( pxEventListItem )
+    #define eventRESET_EVENT_ITEM_VALUE()                                           uxTaskResetEventItemValue()
+    #define eventREMOVE_FROM_EVENT_LIST_FROM_ISR( pxEventListItem, uxItemValue )    xTaskRemoveFromUnorderedEventListFromISR( ( pxEventListItem ), ( uxItemValue ) )
+#endif
+
+/* When configEVENT_GROUP_DIRECT_ISR is 1 interrupts access event groups
+ * directly, so tasks must access them from within a critical section as well as
+ * with the scheduler suspended. */
+#if ( configEVENT_GROUP_DIRECT_ISR == 1 )
+    #define eventENTER_CRITICAL()    taskENTER_CRITICAL()
+    #define eventEXIT_CRITICAL()     taskEXIT_CRITICAL()
+#else
+    #define eventENTER_CRITICAL()
+    #define eventEXIT_CRITICAL()
+#endif
+
 typedef struct EventGroupDef_t
 {
     EventBits_t uxEventBits;
-    List_t xTasksWaitingForBits; /*< List of tasks waiting for a bit to be set. */
+
+    #if ( configEVENT_GROUP_WAITER_LISTS == 1 )
+        List_t xTasksWaitingForBits; /*< List of tasks waiting for a bit to be set. */
+    #else
+        List_t xTasksWaitingForBits[ configEVENT_GROUP_WAITER_LISTS ]; /*< Lists of tasks waiting for a bit to be set.  A task is held in the list selected by the lowest bit it is waiting for. */
+        EventBits_t uxBitsWaitedFor[ configEVENT_GROUP_WAITER_LISTS ];  /*< The bits waited for by the tasks in each list.  Can also hold bits waited for by tasks that have since timed out, which are removed when the list is next scanned. */
+    #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxEventGroupNumber;
@@ -73,6 +111,12 @@ typedef struct EventGroupDef_t
     #endif
 } EventGroup_t;
 
+#if ( configEVENT_GROUP_WAITER_LISTS == 1 )
+    #define eventGET_WAITING_LIST( pxEventBits, uxList )    ( &( ( pxEventBits )->xTasksWaitingForBits ) )
+#else
+    #define eventGET_WAITING_LIST( pxEventBits, uxList )    ( &( ( pxEventBits )->xTasksWaitingForBits[ ( uxList ) ] ) )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -87,6 +131,47 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
                                         const EventBits_t uxBitsToWaitFor,
                                         const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Initialise the list, or lists, of tasks waiting for bits in the event group.
+ */
+static void prvInitialiseWaitingLists( EventGroup_t * pxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Place the calling task on the list of tasks waiting for bits in the event
+ * group, then block it for up to xTicksToWait ticks.  When the event group has
+ * more than one list the task is placed in the list selected by the lowest bit
+ * in uxBitsToWaitFor.  Must be called with the scheduler suspended.
+ */
+static void prvPlaceOnWaitingList( EventGroup_t * pxEventBits,
+                                   const EventBits_t uxBitsToWaitFor,
+                                   const EventBits_t uxControlBits,
+                                   const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set uxBitsToSet in the event group, unblock the tasks whose wait condition is
+ * then met, then clear the bits waited for by any unblocked task that specified
+ * the clear on exit option.  pxHigherPriorityTaskWoken is NULL when called from
+ * a task, which must have suspended the scheduler.  Otherwise it is called from
+ * a critical section within an interrupt, and *pxHigherPriorityTaskWoken is set
+ * to pdTRUE if a task that has a priority above the interrupted task was
+ * unblocked.
+ */
+static void prvSetBits( EventGroup_t * pxEventBits,
+                        const EventBits_t uxBitsToSet,
+                        BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the tasks in pxList whose wait condition is met by the current value
+ * of the event group.  Returns the bits that must be cleared because a task that
+ * was unblocked specified the clear on exit option.  *puxBitsStillWaitedFor is
+ * set to the bits waited for by the tasks that remain in the list.
+ * pxHigherPriorityTaskWoken is used as described for prvSetBits().
+ */
+static EventBits_t prvUnblockWaitingTasks( EventGroup_t * pxEventBits,
+                                           List_t const * pxList,
+                                           EventBits_t * puxBitsStillWaitedFor,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------*/
 
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -114,7 +199,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
         if( pxEventBits != NULL )
         {
             pxEventBits->uxEventBits = 0;
-            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+            prvInitialiseWaitingLists( pxEventBits );
 
             #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
@@ -165,7 +250,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
         if( pxEventBits != NULL )
         {
             pxEventBits->uxEventBits = 0;
-            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+            prvInitialiseWaitingLists( pxEventBits );
 
             #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -208,6 +293,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
     #endif
 
     vTaskSuspendAll();
+    eventENTER_CRITICAL();
     {
         uxOriginalBitValue = pxEventBits->uxEventBits;
 
@@ -233,7 +319,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
                 /* Store the bits that the calling task is waiting for in the
                  * task's event list item so the kernel knows when a match is
                  * found.  Then enter the blocked state. */
-                vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                prvPlaceOnWaitingList( pxEventBits, uxBitsToWaitFor, ( eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
                 /* This assignment is obsolete as uxReturn will get set after
                  * the task unblocks, but some compilers mistakenly generate a
@@ -250,6 +336,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
             }
         }
     }
+    eventEXIT_CRITICAL();
     xAlreadyYielded = xTaskResumeAll();
 
     if( xTicksToWait != ( TickType_t ) 0 )
@@ -267,7 +354,7 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
          * point either the required bits were set or the block time expired.  If
          * the required bits were set they will have been stored in the task's
          * event list item, and they should now be retrieved then cleared. */
-        uxReturn = uxTaskResetEventItemValue();
+        uxReturn = eventRESET_EVENT_ITEM_VALUE();
 
         if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
         {
@@ -335,6 +422,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
     #endif
 
     vTaskSuspendAll();
+    eventENTER_CRITICAL();
     {
         const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -392,7 +480,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
             /* Store the bits that the calling task is waiting for in the
              * task's event list item so the kernel knows when a match is
              * found.  Then enter the blocked state. */
-            vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+            prvPlaceOnWaitingList( pxEventBits, uxBitsToWaitFor, uxControlBits, xTicksToWait );
 
             /* This is obsolete as it will get set after the task unblocks, but
              * some compilers mistakenly generate a warning about the variable
@@ -402,6 +490,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
             traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
         }
     }
+    eventEXIT_CRITICAL();
     xAlreadyYielded = xTaskResumeAll();
 
     if( xTicksToWait != ( TickType_t ) 0 )
@@ -419,7 +508,7 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
          * point either the required bits were set or the block time expired.  If
          * the required bits were set they will have been stored in the task's
          * event list item, and they should now be retrieved then cleared. */
-        uxReturn = uxTaskResetEventItemValue();
+        uxReturn = eventRESET_EVENT_ITEM_VALUE();
 
         if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
         {
@@ -496,20 +585,52 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+#if ( configEVENT_GROUP_DIRECT_ISR == 1 )
+
+    BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
+                                            const EventBits_t uxBitsToClear )
+    {
+        EventGroup_t * pxEventBits = xEventGroup;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xEventGroup );
+        configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+
+            /* Clearing bits cannot unblock a task, so there is nothing else to
+             * do. */
+            pxEventBits->uxEventBits &= ~uxBitsToClear;
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return pdPASS;
+    }
+
+#elif ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_64BIT == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
     BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                             const EventBits_t uxBitsToClear )
     {
         BaseType_t xReturn;
 
+        /* The bits are pended in a 32 bit parameter. */
+        #if ( configEVENT_GROUP_64BIT == 1 )
+            {
+                configASSERT( ( uxBitsToClear & ~( ( EventBits_t ) 0xffffffffUL ) ) == 0 );
+            }
+        #endif
+
         traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
         xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL ); /*lint !e9087 Can't avoid cast to void* as a generic callback function not specific to this use case. Callback casts back to original type so safe. */
 
         return xReturn;
     }
 
-#endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+#endif /* if ( configEVENT_GROUP_DIRECT_ISR == 1 ) */
 /*-----------------------------------------------------------*/
 
 EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
@@ -531,92 +652,21 @@ EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
                                 const EventBits_t uxBitsToSet )
 {
-    ListItem_t * pxListItem, * pxNext;
-    ListItem_t const * pxListEnd;
-    List_t const * pxList;
-    EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
     EventGroup_t * pxEventBits = xEventGroup;
-    BaseType_t xMatchFound = pdFALSE;
 
     /* Check the user is not attempting to set the bits used by the kernel
      * itself. */
     configASSERT( xEventGroup );
     configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-    pxList = &( pxEventBits->xTasksWaitingForBits );
-    pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
     vTaskSuspendAll();
+    eventENTER_CRITICAL();
     {
         traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-        pxListItem = listGET_HEAD_ENTRY( pxList );
-
-        /* Set the bits. */
-        pxEventBits->uxEventBits |= uxBitsToSet;
-
-        /* See if the new bit value should unblock any tasks. */
-        while( pxListItem != pxListEnd )
-        {
-            pxNext = listGET_NEXT( pxListItem );
-            uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-            xMatchFound = pdFALSE;
-
-            /* Split the bits waited for from the control bits. */
-            uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-            uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
-
-            if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
-            {
-                /* Just looking for single bit being set. */
-                if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-                {
-                    xMatchFound = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
-            {
-                /* All bits are set. */
-                xMatchFound = pdTRUE;
-            }
-            else
-            {
-                /* Need all bits to be set, but not all the bits were set. */
-            }
-
-            if( xMatchFound != pdFALSE )
-            {
-                /* The bits match.  Should the bits be cleared on exit? */
-                if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-                {
-                    uxBitsToClear |= uxBitsWaitedFor;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-
-                /* Store the actual event flag value in the task's event list
-                 * item before removing the task from the event list.  The
-                 * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-                 * that is was unblocked due to its required bits matching, rather
-                 * than because it timed out. */
-                vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
-            }
-
-            /* Move onto the next list item.  Note pxListItem->pxNext is not
-             * used here as the list item may have been removed from the event list
-             * and inserted into the ready/pending reading list. */
-            pxListItem = pxNext;
-        }
-
-        /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-         * bit was set in the control word. */
-        pxEventBits->uxEventBits &= ~uxBitsToClear;
+        prvSetBits( pxEventBits, uxBitsToSet, NULL );
     }
+    eventEXIT_CRITICAL();
     ( void ) xTaskResumeAll();
 
     return pxEventBits->uxEventBits;
@@ -626,19 +676,29 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
 void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
     EventGroup_t * pxEventBits = xEventGroup;
-    const List_t * pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+    const List_t * pxTasksWaitingForBits;
+    UBaseType_t uxList;
 
     vTaskSuspendAll();
     {
         traceEVENT_GROUP_DELETE( xEventGroup );
 
-        while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+        eventENTER_CRITICAL();
         {
-            /* Unblock the task, returning 0 as the event list is being deleted
-             * and cannot therefore have any bits set. */
-            configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-            vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+            for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
+            {
+                pxTasksWaitingForBits = eventGET_WAITING_LIST( pxEventBits, uxList );
+
+                while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+                {
+                    /* Unblock the task, returning 0 as the event list is being deleted
+                     * and cannot therefore have any bits set. */
+                    configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+                    eventREMOVE_FROM_EVENT_LIST( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+                }
+            }
         }
+        eventEXIT_CRITICAL();
 
         #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
             {
@@ -720,7 +780,264 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+static void prvInitialiseWaitingLists( EventGroup_t * pxEventBits )
+{
+    #if ( configEVENT_GROUP_WAITER_LISTS == 1 )
+        {
+            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+        }
+    #else
+        {
+            UBaseType_t uxList;
+
+            for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
+            {
+                vListInitialise( &( pxEventBits->xTasksWaitingForBits[ uxList ] ) );
+                pxEventBits->uxBitsWaitedFor[ uxList ] = 0;
+            }
+        }
+    #endif /* configEVENT_GROUP_WAITER_LISTS */
+}
+/*-----------------------------------------------------------*/
+
+static void prvPlaceOnWaitingList( EventGroup_t * pxEventBits,
+                                   const EventBits_t uxBitsToWaitFor,
+                                   const EventBits_t uxControlBits,
+                                   const TickType_t xTicksToWait )
+{
+    #if ( configEVENT_GROUP_MAX_WAITERS > 0 )
+        {
+            UBaseType_t uxWaiters = 0, uxList;
+
+            /* Limiting the number of tasks that can wait on an event group
+             * bounds the time taken to set bits from an interrupt. */
+            for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
+            {
+                uxWaiters += listCURRENT_LIST_LENGTH( eventGET_WAITING_LIST( pxEventBits, uxList ) );
+            }
+
+            configASSERT( uxWaiters < ( UBaseType_t ) configEVENT_GROUP_MAX_WAITERS );
+            ( void ) uxWaiters;
+        }
+    #endif /* configEVENT_GROUP_MAX_WAITERS */
+
+    #if ( configEVENT_GROUP_WAITER_LISTS == 1 )
+        {
+            eventPLACE_ON_EVENT_LIST( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+        }
+    #else
+        {
+            EventBits_t uxBits = uxBitsToWaitFor;
+            UBaseType_t uxList = 0;
+
+            /* Find the lowest bit waited for.  uxBitsToWaitFor is never 0. */
+            while( ( uxBits & ( EventBits_t ) 1 ) == ( EventBits_t ) 0 )
+            {
+                uxBits >>= 1;
+                uxList++;
+            }
+
+            uxList %= ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS;
+
+            pxEventBits->uxBitsWaitedFor[ uxList ] |= uxBitsToWaitFor;
+            eventPLACE_ON_EVENT_LIST( &( pxEventBits->xTasksWaitingForBits[ uxList ] ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+        }
+    #endif /* configEVENT_GROUP_WAITER_LISTS */
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetBits( EventGroup_t * pxEventBits,
+                        const EventBits_t uxBitsToSet,
+                        BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    EventBits_t uxBitsToClear = 0, uxBitsStillWaitedFor;
+
+    /* Set the bits. */
+    pxEventBits->uxEventBits |= uxBitsToSet;
+
+    /* See if the new bit value should unblock any tasks. */
+    #if ( configEVENT_GROUP_WAITER_LISTS == 1 )
+        {
+            uxBitsToClear = prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits ), &uxBitsStillWaitedFor, pxHigherPriorityTaskWoken );
+        }
+    #else
+        {
+            UBaseType_t uxList;
+
+            /* A task that is still blocked was not unblocked by the bits
+             * that were already set, so only a task that is waiting for one
+             * of the bits being set can be unblocked now.  Only the lists
+             * that hold such a task need to be scanned. */
+            for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
+            {
+                if( ( pxEventBits->uxBitsWaitedFor[ uxList ] & uxBitsToSet ) != ( EventBits_t ) 0 )
+                {
+                    uxBitsToClear |= prvUnblockWaitingTasks( pxEventBits, &( pxEventBits->xTasksWaitingForBits[ uxList ] ), &uxBitsStillWaitedFor, pxHigherPriorityTaskWoken );
+                    pxEventBits->uxBitsWaitedFor[ uxList ] = uxBitsStillWaitedFor;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+    #endif /* configEVENT_GROUP_WAITER_LISTS */
+
+    /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+     * bit was set in the control word. */
+    pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+    /* Prevent compiler warnings when only one list is used. */
+    ( void ) uxBitsStillWaitedFor;
+}
+/*-----------------------------------------------------------*/
+
+static EventBits_t prvUnblockWaitingTasks( EventGroup_t * pxEventBits,
+                                           List_t const * pxList,
+                                           EventBits_t * puxBitsStillWaitedFor,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    ListItem_t * pxListItem, * pxNext;
+    ListItem_t const * pxListEnd;
+    EventBits_t uxBitsToClear = 0, uxBitsStillWaitedFor = 0, uxBitsWaitedFor, uxControlBits;
+    BaseType_t xMatchFound;
+
+    pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+    pxListItem = listGET_HEAD_ENTRY( pxList );
+
+    while( pxListItem != pxListEnd )
+    {
+        pxNext = listGET_NEXT( pxListItem );
+        uxBitsWaitedFor = eventGET_EVENT_ITEM_VALUE( pxListItem );
+        xMatchFound = pdFALSE;
+
+        /* Split the bits waited for from the control bits. */
+        uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+        uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+        if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+        {
+            /* Just looking for single bit being set. */
+            if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+            {
+                xMatchFound = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+        {
+            /* All bits are set. */
+            xMatchFound = pdTRUE;
+        }
+        else
+        {
+            /* Need all bits to be set, but not all the bits were set. */
+        }
+
+        if( xMatchFound != pdFALSE )
+        {
+            /* The bits match.  Should the bits be cleared on exit? */
+            if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+            {
+                uxBitsToClear |= uxBitsWaitedFor;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Store the actual event flag value in the task's event list
+             * item before removing the task from the event list.  The
+             * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+             * that is was unblocked due to its required bits matching, rather
+             * than because it timed out. */
+            #if ( configEVENT_GROUP_DIRECT_ISR == 1 )
+                {
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        if( eventREMOVE_FROM_EVENT_LIST_FROM_ISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        eventREMOVE_FROM_EVENT_LIST( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                    }
+                }
+            #else
+                {
+                    eventREMOVE_FROM_EVENT_LIST( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                }
+            #endif /* configEVENT_GROUP_DIRECT_ISR */
+        }
+        else
+        {
+            uxBitsStillWaitedFor |= uxBitsWaitedFor;
+        }
+
+        /* Move onto the next list item.  Note pxListItem->pxNext is not
+         * used here as the list item may have been removed from the event list
+         * and inserted into the ready/pending reading list. */
+        pxListItem = pxNext;
+    }
+
+    *puxBitsStillWaitedFor = uxBitsStillWaitedFor;
+
+    /* Prevent compiler warnings when interrupts do not set bits directly. */
+    ( void ) pxHigherPriorityTaskWoken;
+
+    return uxBitsToClear;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configEVENT_GROUP_DIRECT_ISR == 1 )
+
+    BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
+                                          const EventBits_t uxBitsToSet,
+                                          BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        EventGroup_t * pxEventBits = xEventGroup;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        configASSERT( xEventGroup );
+        configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* Tasks only access the event group from within a critical section, so
+         * the bits can be set, and the tasks waiting for them unblocked, from
+         * here rather than from the timer task.  The time taken is bounded by
+         * the number of tasks waiting on the event group, which can be limited
+         * by configEVENT_GROUP_MAX_WAITERS. */
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+            prvSetBits( pxEventBits, uxBitsToSet, &xHigherPriorityTaskWoken );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( ( xHigherPriorityTaskWoken != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+        {
+            *pxHigherPriorityTaskWoken = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pdPASS;
+    }
+
+#elif ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_64BIT == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                           const EventBits_t uxBitsToSet,
@@ -728,13 +1045,20 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
     {
         BaseType_t xReturn;
 
+        /* The bits are pended in a 32 bit parameter. */
+        #if ( configEVENT_GROUP_64BIT == 1 )
+            {
+                configASSERT( ( uxBitsToSet & ~( ( EventBits_t ) 0xffffffffUL ) ) == 0 );
+            }
+        #endif
+
         traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
         xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken ); /*lint !e9087 Can't avoid cast to void* as a generic callback function not specific to this use case. Callback casts back to original type so safe. */
 
         return xReturn;
     }
 
-#endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+#endif /* if ( configEVENT_GROUP_DIRECT_ISR == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
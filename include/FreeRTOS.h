@@ -56,6 +56,12 @@
 /* Application specific configuration options. */
 #include "FreeRTOSConfig.h"
 
+/* Must be defaulted before portable.h is included as ports that support
+ * symmetric multiprocessing test it in portmacro.h. */
+#ifndef configNUMBER_OF_CORES
+    #define configNUMBER_OF_CORES    1
+#endif
+
 /* Basic FreeRTOS definitions. */
 #include "projdefs.h"
 
@@ -232,6 +238,33 @@
     #define configUSE_TIMERS    0
 #endif
 
+#ifndef configTIMER_USE_WHEEL
+    #define configTIMER_USE_WHEEL    0
+#endif
+
+#ifndef configTIMER_DIRECT_COMMANDS
+    #define configTIMER_DIRECT_COMMANDS    0
+#endif
+
+#ifndef configUSE_FAST_TIMERS
+    #define configUSE_FAST_TIMERS    0
+#endif
+
+#ifndef configTIMER_SERVICE_COUNT
+    #define configTIMER_SERVICE_COUNT    1
+#endif
+
+#if ( configTIMER_SERVICE_COUNT < 1 )
+    #error configTIMER_SERVICE_COUNT must be at least 1.
+#endif
+
+/* The priority of the task of timer service uxService, for uxService from 1 to
+ * ( configTIMER_SERVICE_COUNT - 1 ).  Timer service 0 always runs at
+ * configTIMER_TASK_PRIORITY. */
+#ifndef configTIMER_SERVICE_TASK_PRIORITY
+    #define configTIMER_SERVICE_TASK_PRIORITY( uxService )    configTIMER_TASK_PRIORITY
+#endif
+
 #ifndef configUSE_COUNTING_SEMAPHORES
     #define configUSE_COUNTING_SEMAPHORES    0
 #endif
@@ -556,6 +589,10 @@
     #define traceTASK_DELETE( pxTaskToDelete )
 #endif
 
+#ifndef traceTASK_UNBLOCK_DEFERRED
+    #define traceTASK_UNBLOCK_DEFERRED( pxTCB )
+#endif
+
 #ifndef traceTASK_DELAY_UNTIL
     #define traceTASK_DELAY_UNTIL( x )
 #endif
@@ -814,6 +851,57 @@
     #define configUSE_QUEUE_SETS    0
 #endif
 
+#ifndef configUSE_BUFFER_QUEUES
+    #define configUSE_BUFFER_QUEUES    0
+#endif
+
+#ifndef configUSE_POOLS
+    #define configUSE_POOLS    0
+#endif
+
+/* Set to 1 to have xPoolFree() and xPoolFreeFromISR() reject a block that is
+ * already free.  The check walks the free list with interrupts masked, so
+ * freeing a block no longer takes a constant time. */
+#ifndef configPOOL_CHECK_DOUBLE_FREE
+    #define configPOOL_CHECK_DOUBLE_FREE    0
+#endif
+
+#ifndef configUSE_NOTIFY_QUEUES
+    #define configUSE_NOTIFY_QUEUES    0
+#endif
+
+/* The number of lists each event group keeps its waiting tasks in.  A task is
+ * placed in the list selected by the lowest bit it waits for, so setting bits
+ * only has to test the tasks in lists that contain a task waiting for one of
+ * the bits being set. */
+#ifndef configEVENT_GROUP_WAITER_LISTS
+    #define configEVENT_GROUP_WAITER_LISTS    1
+#endif
+
+#if ( configEVENT_GROUP_WAITER_LISTS < 1 )
+    #error configEVENT_GROUP_WAITER_LISTS must be at least 1.
+#endif
+
+/* Set to 1 to make EventBits_t a 64 bit type, giving 56 usable bits in each
+ * event group whatever the tick type.  The bits a task is waiting for are then
+ * held in the task's TCB rather than in its event list item. */
+#ifndef configEVENT_GROUP_64BIT
+    #define configEVENT_GROUP_64BIT    0
+#endif
+
+/* Set to 1 for xEventGroupSetBitsFromISR() and xEventGroupClearBitsFromISR() to
+ * update the event group from the interrupt, rather than deferring the update
+ * to the timer task.  Tasks then access event groups from critical sections. */
+#ifndef configEVENT_GROUP_DIRECT_ISR
+    #define configEVENT_GROUP_DIRECT_ISR    0
+#endif
+
+/* The maximum number of tasks that can be blocked on one event group at a time,
+ * or 0 for no limit. */
+#ifndef configEVENT_GROUP_MAX_WAITERS
+    #define configEVENT_GROUP_MAX_WAITERS    0
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
     #define portTASK_USES_FLOATING_POINT()
 #endif
@@ -862,14 +950,52 @@
     #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
 #endif
 
+#ifndef configUSE_PRIORITY_BITMAP_TASK_SELECTION
+    #define configUSE_PRIORITY_BITMAP_TASK_SELECTION    0
+#endif
+
+/* Set to 1 to hold delayed tasks in radix buckets rather than in lists sorted by
+ * wake time, so delaying a task takes a constant time however many other tasks
+ * are delayed.  Uses ( ( bits in TickType_t ) + 1 ) lists per delayed list. */
+#ifndef configUSE_RADIX_DELAYED_LISTS
+    #define configUSE_RADIX_DELAYED_LISTS    0
+#endif
+
+/* The most tasks the tick interrupt moves out of the Blocked state on one tick,
+ * or 0 for no limit.  Due tasks beyond the limit are moved by the next context
+ * switch, which also moves no more than this many, or by the next tick. */
+#ifndef configTICK_MAX_UNBLOCKS
+    #define configTICK_MAX_UNBLOCKS    0
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
     #define configAPPLICATION_ALLOCATED_HEAP    0
 #endif
 
+#ifndef configUSE_HEAP_SIZE_CLASSES
+    /* Set to 1 to have heap_4 and heap_5 keep per-size free lists for small blocks. */
+    #define configUSE_HEAP_SIZE_CLASSES    0
+#endif
+
+#ifndef configHEAP_SIZE_CLASS_MAX_SIZE
+    /* The largest block (including its header) held on a size class free list. */
+    #define configHEAP_SIZE_CLASS_MAX_SIZE    256
+#endif
+
+#ifndef configHEAP6_EXACT_FIT_FALLBACK
+    /* Set to 1 to have heap_6 walk a free list for a large enough block when
+     * its constant time search finds none. */
+    #define configHEAP6_EXACT_FIT_FALLBACK    0
+#endif
+
 #ifndef configUSE_TASK_NOTIFICATIONS
     #define configUSE_TASK_NOTIFICATIONS    1
 #endif
 
+#if ( ( configUSE_NOTIFY_QUEUES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_TASK_NOTIFICATIONS must be set to 1 to use notify queues
+#endif
+
 #ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
     #define configTASK_NOTIFICATION_ARRAY_ENTRIES    1
 #endif
@@ -878,6 +1004,17 @@
     #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
+/* The index of the notification a task blocks on while it receives from a
+ * notify queue.  Only the notification state at this index is used, never its
+ * value. */
+#ifndef configNOTIFY_QUEUE_NOTIFICATION_INDEX
+    #define configNOTIFY_QUEUE_NOTIFICATION_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+#endif
+
+#if ( ( configUSE_NOTIFY_QUEUES == 1 ) && ( configNOTIFY_QUEUE_NOTIFICATION_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) )
+    #error configNOTIFY_QUEUE_NOTIFICATION_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
     #define configUSE_POSIX_ERRNO    0
 #endif
@@ -911,6 +1048,20 @@
     #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
 #endif
 
+#ifndef configUSE_STREAM_BUFFER_CHANNELS
+
+/* Set to 1 to allow stream and message buffers to be shared with another
+ * kernel instance, see xStreamBufferCreateChannel(). */
+    #define configUSE_STREAM_BUFFER_CHANNELS    0
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_FAST_PATH
+
+/* Set to 1 to let a single writer and a single reader use a stream or message
+ * buffer without locking the kernel unless the other end is blocked. */
+    #define configUSE_STREAM_BUFFER_FAST_PATH    0
+#endif
+
 /* Sanity check the configuration. */
 #if ( configUSE_TICKLESS_IDLE != 0 )
     #if ( INCLUDE_vTaskSuspend != 1 )
@@ -922,10 +1073,48 @@
     #error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
 #endif
 
+#if ( ( configUSE_STREAM_BUFFER_CHANNELS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION != 1 ) )
+    #error configSUPPORT_STATIC_ALLOCATION must be set to 1 to use stream buffer channels
+#endif
+
 #if ( ( configUSE_RECURSIVE_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
     #error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if ( configNUMBER_OF_CORES > 1 )
+    #ifndef portGET_CORE_ID
+        #error portGET_CORE_ID() must be defined by the port if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #ifndef portYIELD_CORE
+        #error portYIELD_CORE() must be defined by the port if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if !defined( portGET_TASK_LOCK ) || !defined( portRELEASE_TASK_LOCK ) || !defined( portGET_ISR_LOCK ) || !defined( portRELEASE_ISR_LOCK )
+        #error The port must define the task and ISR lock macros if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if !defined( portSET_INTERRUPT_MASK ) || !defined( portCLEAR_INTERRUPT_MASK )
+        #error portSET_INTERRUPT_MASK() and portCLEAR_INTERRUPT_MASK() must be defined by the port if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION != 0 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION is not supported if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        #error configUSE_TICKLESS_IDLE is not supported if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if ( configGENERATE_RUN_TIME_STATS != 0 )
+        #error configGENERATE_RUN_TIME_STATS is not supported if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if ( configUSE_CO_ROUTINES != 0 )
+        #error configUSE_CO_ROUTINES is not supported if configNUMBER_OF_CORES is greater than 1
+    #endif
+#endif /* configNUMBER_OF_CORES */
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -1209,6 +1398,12 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xDummy23;
+    #endif
+    #if ( configEVENT_GROUP_64BIT == 1 )
+        uint64_t ullDummy24;
+    #endif
 } StaticTask_t;
 
 /*
@@ -1251,9 +1446,29 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_BUFFER_QUEUES == 1 )
+        void * pvDummy10;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
+/* Memory pools are built on a counting semaphore that counts the free blocks. */
+typedef struct xSTATIC_POOL
+{
+    StaticQueue_t xDummy1;
+    void * pvDummy2[ 2 ];
+    size_t uxDummy3;
+} StaticPool_t;
+
+/* Notify queues hold the positions of the ring, the storage and the receiving
+ * task. */
+typedef struct xSTATIC_NOTIFY_QUEUE
+{
+    uint32_t ulDummy1[ 3 ];
+    void * pvDummy2[ 2 ];
+} StaticNotifyQueue_t;
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1270,8 +1485,21 @@ typedef StaticQueue_t StaticSemaphore_t;
  */
 typedef struct xSTATIC_EVENT_GROUP
 {
-    TickType_t xDummy1;
-    StaticList_t xDummy2;
+    #if ( configEVENT_GROUP_64BIT == 1 )
+        uint64_t ullDummy1;
+    #else
+        TickType_t xDummy1;
+    #endif
+
+    #if ( configEVENT_GROUP_WAITER_LISTS == 1 )
+        StaticList_t xDummy2;
+    #elif ( configEVENT_GROUP_64BIT == 1 )
+        StaticList_t xDummy2[ configEVENT_GROUP_WAITER_LISTS ];
+        uint64_t ullDummy5[ configEVENT_GROUP_WAITER_LISTS ];
+    #else
+        StaticList_t xDummy2[ configEVENT_GROUP_WAITER_LISTS ];
+        TickType_t xDummy5[ configEVENT_GROUP_WAITER_LISTS ];
+    #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy3;
@@ -1306,6 +1534,9 @@ typedef struct xSTATIC_TIMER
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy7;
     #endif
+    #if ( configTIMER_SERVICE_COUNT > 1 )
+        void * pvDummy9;
+    #endif
     uint8_t ucDummy8;
 } StaticTimer_t;
 
@@ -28,9 +28,12 @@
  * @file atomic.h
  * @brief FreeRTOS atomic operation support.
  *
- * This file implements atomic functions by disabling interrupts globally.
- * Implementations with architecture specific atomic instructions can be
- * provided under each compiler directory.
+ * When the compiler provides the GCC/Clang __atomic builtins this file
+ * implements atomic functions with the architecture's atomic instructions,
+ * which are also safe when more than one core accesses the variable.  Otherwise
+ * it implements them by disabling interrupts globally.  Implementations with
+ * architecture specific atomic instructions can be provided under each compiler
+ * directory.
  */
 
 #ifndef ATOMIC_H
@@ -79,10 +82,61 @@
  * Inline is compiler specific, and may not always get inlined depending on your
  * optimization level.  Also, inline is considered as performance optimization
  * for atomic.  Thus, if portFORCE_INLINE is not provided by portmacro.h,
- * instead of resulting error, simply define it away.
+ * instead of resulting error, fall back to a plain inline hint with compilers
+ * that accept one in any language mode, so helpers that are not used do not
+ * cause warnings, or simply define it away.
  */
 #ifndef portFORCE_INLINE
-    #define portFORCE_INLINE
+    #if defined( __GNUC__ )
+        #define portFORCE_INLINE    __inline__
+    #else
+        #define portFORCE_INLINE
+    #endif
+#endif
+
+/*
+ * Port specific definition -- use the compiler's atomic builtins.
+ * When portATOMIC_USE_BUILTINS is 1 the functions in this file are implemented
+ * with the __atomic builtins, so compile to single atomic instructions (for
+ * example LDREX/STREX, AMO or lock prefixed instructions) instead of a critical
+ * section.  The builtins are only used for the widths the compiler reports as
+ * always lock free, so a width the architecture cannot update atomically still
+ * uses a critical section rather than a call into a support library.  A port can
+ * define portATOMIC_USE_BUILTINS to 0 in portmacro.h to always use critical
+ * sections.
+ */
+#ifndef portATOMIC_USE_BUILTINS
+    #if defined( __GNUC__ ) && defined( __ATOMIC_SEQ_CST )
+        #define portATOMIC_USE_BUILTINS    1
+    #else
+        #define portATOMIC_USE_BUILTINS    0
+    #endif
+#endif
+
+#if ( portATOMIC_USE_BUILTINS == 1 )
+    #if ( ( __SIZEOF_INT__ == 4 ) && ( __GCC_ATOMIC_INT_LOCK_FREE == 2 ) ) || ( ( __SIZEOF_LONG__ == 4 ) && ( __GCC_ATOMIC_LONG_LOCK_FREE == 2 ) )
+        #define atomicUSE_BUILTINS_32    1
+    #endif
+
+    #if ( __SIZEOF_LONG_LONG__ == 8 ) && ( __GCC_ATOMIC_LLONG_LOCK_FREE == 2 )
+        #define atomicUSE_BUILTINS_64    1
+    #endif
+
+    #if ( __GCC_ATOMIC_POINTER_LOCK_FREE == 2 )
+        #define atomicUSE_BUILTINS_POINTER    1
+    #endif
+#endif /* portATOMIC_USE_BUILTINS */
+
+#ifndef atomicUSE_BUILTINS_32
+    #define atomicUSE_BUILTINS_32    0
+#endif
+
+#ifndef atomicUSE_BUILTINS_64
+    #define atomicUSE_BUILTINS_64    0
+#endif
+
+#ifndef atomicUSE_BUILTINS_POINTER
+    #define atomicUSE_BUILTINS_POINTER    0
 #endif
 
 #define ATOMIC_COMPARE_AND_SWAP_SUCCESS    0x1U     /**< Compare and swap succeeded, swapped. */
@@ -111,19 +165,34 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u32( uint32_t volatile *
 {
     uint32_t ulReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        if( *pulDestination == ulComparand )
+    #if ( atomicUSE_BUILTINS_32 == 1 )
         {
-            *pulDestination = ulExchange;
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            if( __atomic_compare_exchange_n( pulDestination, &ulComparand, ulExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
         }
-        else
+    #else
         {
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            ATOMIC_ENTER_CRITICAL();
+            {
+                if( *pulDestination == ulComparand )
+                {
+                    *pulDestination = ulExchange;
+                    ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+                }
+                else
+                {
+                    ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+                }
+            }
+            ATOMIC_EXIT_CRITICAL();
         }
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulReturnValue;
 }
@@ -146,12 +215,20 @@ static portFORCE_INLINE void * Atomic_SwapPointers_p32( void * volatile * ppvDes
 {
     void * pReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        pReturnValue = *ppvDestination;
-        *ppvDestination = pvExchange;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_POINTER == 1 )
+        {
+            pReturnValue = __atomic_exchange_n( ppvDestination, pvExchange, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                pReturnValue = *ppvDestination;
+                *ppvDestination = pvExchange;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return pReturnValue;
 }
@@ -179,15 +256,26 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwapPointers_p32( void * volat
 {
     uint32_t ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        if( *ppvDestination == pvComparand )
+    #if ( atomicUSE_BUILTINS_POINTER == 1 )
         {
-            *ppvDestination = pvExchange;
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            if( __atomic_compare_exchange_n( ppvDestination, &pvComparand, pvExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
         }
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                if( *ppvDestination == pvComparand )
+                {
+                    *ppvDestination = pvExchange;
+                    ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+                }
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulReturnValue;
 }
@@ -211,12 +299,20 @@ static portFORCE_INLINE uint32_t Atomic_Add_u32( uint32_t volatile * pulAddend,
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulAddend;
-        *pulAddend += ulCount;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_add( pulAddend, ulCount, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulAddend;
+                *pulAddend += ulCount;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -239,12 +335,20 @@ static portFORCE_INLINE uint32_t Atomic_Subtract_u32( uint32_t volatile * pulAdd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulAddend;
-        *pulAddend -= ulCount;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_sub( pulAddend, ulCount, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulAddend;
+                *pulAddend -= ulCount;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -264,12 +368,20 @@ static portFORCE_INLINE uint32_t Atomic_Increment_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulAddend;
-        *pulAddend += 1;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_add( pulAddend, 1U, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulAddend;
+                *pulAddend += 1;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -289,12 +401,20 @@ static portFORCE_INLINE uint32_t Atomic_Decrement_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulAddend;
-        *pulAddend -= 1;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_sub( pulAddend, 1U, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulAddend;
+                *pulAddend -= 1;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -317,12 +437,20 @@ static portFORCE_INLINE uint32_t Atomic_OR_u32( uint32_t volatile * pulDestinati
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulDestination;
-        *pulDestination |= ulValue;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_or( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulDestination;
+                *pulDestination |= ulValue;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -344,12 +472,20 @@ static portFORCE_INLINE uint32_t Atomic_AND_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulDestination;
-        *pulDestination &= ulValue;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_and( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulDestination;
+                *pulDestination &= ulValue;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -371,12 +507,20 @@ static portFORCE_INLINE uint32_t Atomic_NAND_u32( uint32_t volatile * pulDestina
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulDestination;
-        *pulDestination = ~( ulCurrent & ulValue );
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_nand( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulDestination;
+                *pulDestination = ~( ulCurrent & ulValue );
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
@@ -398,16 +542,362 @@ static portFORCE_INLINE uint32_t Atomic_XOR_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
-    {
-        ulCurrent = *pulDestination;
-        *pulDestination ^= ulValue;
-    }
-    ATOMIC_EXIT_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+        {
+            ulCurrent = __atomic_fetch_xor( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ulCurrent = *pulDestination;
+                *pulDestination ^= ulValue;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
 
     return ulCurrent;
 }
 
+/*----------------------------- 64 bit ------------------------------*/
+
+/*
+ * The 64 bit functions behave as the 32 bit functions above.  Where the
+ * architecture cannot update a 64 bit variable atomically, for example on most
+ * 32 bit architectures, they use a critical section.
+ */
+
+/**
+ * Atomic compare-and-swap (64 bit)
+ *
+ * @brief Performs an atomic compare-and-swap operation on the specified values.
+ *
+ * @param[in, out] pullDestination Pointer to memory location from where value is
+ *                               to be loaded and checked.
+ * @param[in] ullExchange        If condition meets, write this value to memory.
+ * @param[in] ullComparand       Swap condition.
+ *
+ * @return Unsigned integer of value 1 or 0. 1 for swapped, 0 for not swapped.
+ *
+ * @note This function only swaps *pullDestination with ullExchange, if previous
+ *       *pullDestination value equals ullComparand.
+ */
+static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u64( uint64_t volatile * pullDestination,
+                                                            uint64_t ullExchange,
+                                                            uint64_t ullComparand )
+{
+    uint32_t ulReturnValue;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            if( __atomic_compare_exchange_n( pullDestination, &ullComparand, ullExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                if( *pullDestination == ullComparand )
+                {
+                    *pullDestination = ullExchange;
+                    ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+                }
+                else
+                {
+                    ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+                }
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ulReturnValue;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic add (64 bit)
+ *
+ * @brief Atomically adds count to the value of the specified pointer points to.
+ *
+ * @param[in,out] pullAddend Pointer to memory location from where value is to be
+ *                         loaded and written back to.
+ * @param[in] ullCount     Value to be added to *pullAddend.
+ *
+ * @return previous *pullAddend value.
+ */
+static portFORCE_INLINE uint64_t Atomic_Add_u64( uint64_t volatile * pullAddend,
+                                                 uint64_t ullCount )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_add( pullAddend, ullCount, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullAddend;
+                *pullAddend += ullCount;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic subtract (64 bit)
+ *
+ * @brief Atomically subtracts count from the value of the specified pointer
+ *        pointers to.
+ *
+ * @param[in,out] pullAddend Pointer to memory location from where value is to be
+ *                         loaded and written back to.
+ * @param[in] ullCount     Value to be subtract from *pullAddend.
+ *
+ * @return previous *pullAddend value.
+ */
+static portFORCE_INLINE uint64_t Atomic_Subtract_u64( uint64_t volatile * pullAddend,
+                                                      uint64_t ullCount )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_sub( pullAddend, ullCount, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullAddend;
+                *pullAddend -= ullCount;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic increment (64 bit)
+ *
+ * @brief Atomically increments the value of the specified pointer points to.
+ *
+ * @param[in,out] pullAddend Pointer to memory location from where value is to be
+ *                         loaded and written back to.
+ *
+ * @return *pullAddend value before increment.
+ */
+static portFORCE_INLINE uint64_t Atomic_Increment_u64( uint64_t volatile * pullAddend )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_add( pullAddend, 1ULL, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullAddend;
+                *pullAddend += 1;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic decrement (64 bit)
+ *
+ * @brief Atomically decrements the value of the specified pointer points to
+ *
+ * @param[in,out] pullAddend Pointer to memory location from where value is to be
+ *                         loaded and written back to.
+ *
+ * @return *pullAddend value before decrement.
+ */
+static portFORCE_INLINE uint64_t Atomic_Decrement_u64( uint64_t volatile * pullAddend )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_sub( pullAddend, 1ULL, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullAddend;
+                *pullAddend -= 1;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic OR (64 bit)
+ *
+ * @brief Performs an atomic OR operation on the specified values.
+ *
+ * @param [in, out] pullDestination Pointer to memory location from where value is
+ *                                to be loaded and written back to.
+ * @param [in] ullValue           Value to be ORed with *pullDestination.
+ *
+ * @return The original value of *pullDestination.
+ */
+static portFORCE_INLINE uint64_t Atomic_OR_u64( uint64_t volatile * pullDestination,
+                                                uint64_t ullValue )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_or( pullDestination, ullValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullDestination;
+                *pullDestination |= ullValue;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic AND (64 bit)
+ *
+ * @brief Performs an atomic AND operation on the specified values.
+ *
+ * @param [in, out] pullDestination Pointer to memory location from where value is
+ *                                to be loaded and written back to.
+ * @param [in] ullValue           Value to be ANDed with *pullDestination.
+ *
+ * @return The original value of *pullDestination.
+ */
+static portFORCE_INLINE uint64_t Atomic_AND_u64( uint64_t volatile * pullDestination,
+                                                 uint64_t ullValue )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_and( pullDestination, ullValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullDestination;
+                *pullDestination &= ullValue;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic NAND (64 bit)
+ *
+ * @brief Performs an atomic NAND operation on the specified values.
+ *
+ * @param [in, out] pullDestination Pointer to memory location from where value is
+ *                                to be loaded and written back to.
+ * @param [in] ullValue           Value to be NANDed with *pullDestination.
+ *
+ * @return The original value of *pullDestination.
+ */
+static portFORCE_INLINE uint64_t Atomic_NAND_u64( uint64_t volatile * pullDestination,
+                                                  uint64_t ullValue )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_nand( pullDestination, ullValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullDestination;
+                *pullDestination = ~( ullCurrent & ullValue );
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic XOR (64 bit)
+ *
+ * @brief Performs an atomic XOR operation on the specified values.
+ *
+ * @param [in, out] pullDestination Pointer to memory location from where value is
+ *                                to be loaded and written back to.
+ * @param [in] ullValue           Value to be XORed with *pullDestination.
+ *
+ * @return The original value of *pullDestination.
+ */
+static portFORCE_INLINE uint64_t Atomic_XOR_u64( uint64_t volatile * pullDestination,
+                                                 uint64_t ullValue )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+        {
+            ullCurrent = __atomic_fetch_xor( pullDestination, ullValue, __ATOMIC_SEQ_CST );
+        }
+    #else
+        {
+            ATOMIC_ENTER_CRITICAL();
+            {
+                ullCurrent = *pullDestination;
+                *pullDestination ^= ullValue;
+            }
+            ATOMIC_EXIT_CRITICAL();
+        }
+    #endif
+
+    return ullCurrent;
+}
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -83,14 +83,19 @@ struct EventGroupDef_t;
 typedef struct EventGroupDef_t   * EventGroupHandle_t;
 
 /*
- * The type that holds event bits always matches TickType_t - therefore the
- * number of bits it holds is set by configUSE_16_BIT_TICKS (16 bits if set to 1,
- * 32 bits if set to 0.
+ * The type that holds event bits matches TickType_t - therefore the number of
+ * bits it holds is set by configUSE_16_BIT_TICKS (16 bits if set to 1, 32 bits
+ * if set to 0) - unless configEVENT_GROUP_64BIT is set to 1, in which case it
+ * holds 64 bits.
  *
  * \defgroup EventBits_t EventBits_t
  * \ingroup EventGroup
  */
-typedef TickType_t               EventBits_t;
+#if ( configEVENT_GROUP_64BIT == 1 )
+    typedef uint64_t             EventBits_t;
+#else
+    typedef TickType_t           EventBits_t;
+#endif
 
 /**
  * event_groups.h
@@ -115,7 +120,9 @@ typedef TickType_t               EventBits_t;
  * on the configUSE_16_BIT_TICKS setting in FreeRTOSConfig.h.  If
  * configUSE_16_BIT_TICKS is 1 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configUSE_16_BIT_TICKS is set to 0 then each event group has
- * 24 usable bits (bit 0 to bit 23).  The EventBits_t type is used to store
+ * 24 usable bits (bit 0 to bit 23).  If configEVENT_GROUP_64BIT is set to 1
+ * then each event group has 56 usable bits (bit 0 to bit 55), whatever the
+ * setting of configUSE_16_BIT_TICKS.  The EventBits_t type is used to store
  * event bits within an event group.
  *
  * @return If the event group was created then a handle to the event group is
@@ -171,7 +178,9 @@ typedef TickType_t               EventBits_t;
  * on the configUSE_16_BIT_TICKS setting in FreeRTOSConfig.h.  If
  * configUSE_16_BIT_TICKS is 1 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configUSE_16_BIT_TICKS is set to 0 then each event group has
- * 24 usable bits (bit 0 to bit 23).  The EventBits_t type is used to store
+ * 24 usable bits (bit 0 to bit 23).  If configEVENT_GROUP_64BIT is set to 1
+ * then each event group has 56 usable bits (bit 0 to bit 55), whatever the
+ * setting of configUSE_16_BIT_TICKS.  The EventBits_t type is used to store
  * event bits within an event group.
  *
  * @param pxEventGroupBuffer pxEventGroupBuffer must point to a variable of type
@@ -375,11 +384,18 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * timer task to have the clear operation performed in the context of the timer
  * task.
  *
+ * If configEVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h then tasks
+ * access event groups from within critical sections, and
+ * xEventGroupClearBitsFromISR() clears the bits directly.  The timer task is not
+ * used, pdPASS is always returned, and bits above bit 31 can be cleared.
+ *
  * @param xEventGroup The event group in which the bits are to be cleared.
  *
  * @param uxBitsToClear A bitwise value that indicates the bit or bits to clear.
  * For example, to clear bit 3 only, set uxBitsToClear to 0x08.  To clear bit 3
- * and bit 0 set uxBitsToClear to 0x09.
+ * and bit 0 set uxBitsToClear to 0x09.  The bits are passed to the timer task
+ * in a 32 bit value, so when configEVENT_GROUP_64BIT is 1 only bits 0 to 31 can
+ * be cleared from an interrupt.
  *
  * @return If the request to execute the function was posted successfully then
  * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
@@ -410,7 +426,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_64BIT == 1 ) || ( configEVENT_GROUP_DIRECT_ISR == 1 )
     BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                             const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
 #else
@@ -509,11 +525,24 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configEVENT_GROUP_DIRECT_ISR is set to 1 in FreeRTOSConfig.h then tasks
+ * access event groups from within critical sections, and
+ * xEventGroupSetBitsFromISR() sets the bits and unblocks the tasks waiting for
+ * them directly.  The timer task is not used, pdPASS is always returned, and
+ * bits above bit 31 can be set.  *pxHigherPriorityTaskWoken is set to pdTRUE
+ * if a task that was unblocked has a priority above that of the interrupted
+ * task.  The time spent in the interrupt grows with the number of tasks waiting
+ * on the event group, which can be bounded by setting
+ * configEVENT_GROUP_MAX_WAITERS to the most tasks that may wait on one event
+ * group at a time.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
  * For example, to set bit 3 only, set uxBitsToSet to 0x08.  To set bit 3
- * and bit 0 set uxBitsToSet to 0x09.
+ * and bit 0 set uxBitsToSet to 0x09.  The bits are passed to the timer task in a
+ * 32 bit value, so when configEVENT_GROUP_64BIT is 1 only bits 0 to 31 can be
+ * set from an interrupt.
  *
  * @param pxHigherPriorityTaskWoken As mentioned above, calling this function
  * will result in a message being sent to the timer daemon task.  If the
@@ -565,7 +594,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 ) || ( configEVENT_GROUP_64BIT == 1 ) || ( configEVENT_GROUP_DIRECT_ISR == 1 )
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                           const EventBits_t uxBitsToSet,
                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
@@ -210,6 +210,63 @@ typedef void * MessageBufferHandle_t;
 #define xMessageBufferCreateStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) \
     ( MessageBufferHandle_t ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, 0, pdTRUE, pucMessageBufferStorageArea, pxStaticMessageBuffer )
 
+/**
+ * message_buffer.h
+ *
+ * <pre>
+ * MessageBufferHandle_t xMessageBufferCreateChannel( size_t xBufferSizeBytes,
+ *                                                 uint8_t *pucMessageBufferStorageArea,
+ *                                                 StaticMessageBuffer_t *pxStaticMessageBuffer );
+ * </pre>
+ * Creates a message buffer that is used as a channel between two kernel
+ * instances, such as two independent FreeRTOS images running on the cores of
+ * an asymmetric multiprocessing (AMP) device.  The memory must be shared by the
+ * two instances.  See xStreamBufferCreateChannel() for the requirements and the
+ * doorbell macros that must be defined.
+ *
+ * The other instance obtains a handle to the channel by calling
+ * xMessageBufferOpenChannel( pxStaticMessageBuffer ).
+ *
+ * configUSE_STREAM_BUFFER_CHANNELS and configSUPPORT_STATIC_ALLOCATION must be
+ * set to 1 in FreeRTOSConfig.h for xMessageBufferCreateChannel() to be
+ * available.
+ *
+ * @param xBufferSizeBytes The size, in bytes, of the buffer pointed to by the
+ * pucMessageBufferStorageArea parameter.
+ *
+ * @param pucMessageBufferStorageArea Must point to a uint8_t array in shared
+ * memory that is at least xBufferSizeBytes + 1 big.
+ *
+ * @param pxStaticMessageBuffer Must point to a variable of type
+ * StaticMessageBuffer_t in shared memory, which will be used to hold the
+ * channel's data structure.
+ *
+ * @return If the channel is created successfully then a handle to the created
+ * channel is returned. If either pucMessageBufferStorageArea or
+ * pxStaticmessageBuffer are NULL then NULL is returned.
+ *
+ * \defgroup xMessageBufferCreateChannel xMessageBufferCreateChannel
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferCreateChannel( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) \
+    ( MessageBufferHandle_t ) xStreamBufferGenericCreateChannel( xBufferSizeBytes, 0, pdTRUE, pucMessageBufferStorageArea, pxStaticMessageBuffer )
+
+/**
+ * message_buffer.h
+ *
+ * <pre>
+ * MessageBufferHandle_t xMessageBufferOpenChannel( StaticMessageBuffer_t *pxStaticMessageBuffer );
+ * </pre>
+ * Obtains a handle to a channel created by another kernel instance using
+ * xMessageBufferCreateChannel().  Returns NULL if the other instance has not
+ * created the channel yet.
+ *
+ * \defgroup xMessageBufferOpenChannel xMessageBufferOpenChannel
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferOpenChannel( pxStaticMessageBuffer ) \
+    ( MessageBufferHandle_t ) xStreamBufferOpenChannel( pxStaticMessageBuffer )
+
 /**
  * message_buffer.h
  *
@@ -606,6 +663,96 @@ typedef void * MessageBufferHandle_t;
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+ * <pre>
+ * size_t xMessageBufferReserve( MessageBufferHandle_t xMessageBuffer,
+ *                            void **ppvData,
+ *                            size_t xDataLengthBytes );
+ * </pre>
+ *
+ * Obtains a pointer to space for a whole message in a message buffer's storage
+ * area, so the message can be written in place, then made available to the
+ * reader with xMessageBufferCommit() or xMessageBufferCommitFromISR().  Returns
+ * 0 if there is not enough space, or if the message would wrap past the end of
+ * the storage area, in which case it must be sent with xMessageBufferSend().
+ * See xStreamBufferReserve().
+ *
+ * \defgroup xMessageBufferReserve xMessageBufferReserve
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReserve( xMessageBuffer, ppvData, xDataLengthBytes ) \
+    xStreamBufferReserve( ( StreamBufferHandle_t ) xMessageBuffer, ppvData, xDataLengthBytes )
+
+/**
+ * message_buffer.h
+ *
+ * <pre>
+ * size_t xMessageBufferCommit( MessageBufferHandle_t xMessageBuffer,
+ *                           size_t xDataLengthBytes );
+ * size_t xMessageBufferCommitFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                  size_t xDataLengthBytes,
+ *                                  BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Makes a message written in place after a call to xMessageBufferReserve()
+ * available to the reader.  xDataLengthBytes is the length of the message, and
+ * must not be more than the number of bytes reserved.  See
+ * xStreamBufferCommit().
+ *
+ * \defgroup xMessageBufferCommit xMessageBufferCommit
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferCommit( xMessageBuffer, xDataLengthBytes ) \
+    xStreamBufferCommit( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes )
+#define xMessageBufferCommitFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) \
+    xStreamBufferCommitFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+ * <pre>
+ * size_t xMessageBufferPeekContiguous( MessageBufferHandle_t xMessageBuffer,
+ *                                   void **ppvData );
+ * </pre>
+ *
+ * Obtains a pointer to the next message in a message buffer's storage area, so
+ * the message can be processed in place, then released with
+ * xMessageBufferConsume() or xMessageBufferConsumeFromISR().  Returns 0 if the
+ * message buffer is empty, or if the next message wraps past the end of the
+ * storage area, in which case it must be read with xMessageBufferReceive().
+ * See xStreamBufferPeekContiguous().
+ *
+ * \defgroup xMessageBufferPeekContiguous xMessageBufferPeekContiguous
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferPeekContiguous( xMessageBuffer, ppvData ) \
+    xStreamBufferPeekContiguous( ( StreamBufferHandle_t ) xMessageBuffer, ppvData )
+
+/**
+ * message_buffer.h
+ *
+ * <pre>
+ * size_t xMessageBufferConsume( MessageBufferHandle_t xMessageBuffer,
+ *                            size_t xDataLengthBytes );
+ * size_t xMessageBufferConsumeFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                   size_t xDataLengthBytes,
+ *                                   BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Removes the message obtained by a call to xMessageBufferPeekContiguous() from
+ * the message buffer.  xDataLengthBytes must be the length returned by
+ * xMessageBufferPeekContiguous().  See xStreamBufferConsume().
+ *
+ * \defgroup xMessageBufferConsume xMessageBufferConsume
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferConsume( xMessageBuffer, xDataLengthBytes ) \
+    xStreamBufferConsume( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes )
+#define xMessageBufferConsumeFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) \
+    xStreamBufferConsumeFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
 /**
  * message_buffer.h
  *
@@ -729,7 +876,7 @@ typedef void * MessageBufferHandle_t;
  * \ingroup MessageBufferManagement
  */
 #define xMessageBufferNextLengthBytes( xMessageBuffer ) \
-    xStreamBufferNextMessageLengthBytes( ( StreamBufferHandle_t ) xMessageBuffer ) PRIVILEGED_FUNCTION;
+    xStreamBufferNextMessageLengthBytes( ( StreamBufferHandle_t ) xMessageBuffer )
 
 /**
  * message_buffer.h
@@ -70,6 +70,7 @@ void MPU_vTaskSuspendAll( void ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xTaskResumeAll( void ) FREERTOS_SYSTEM_CALL;
 TickType_t MPU_xTaskGetTickCount( void ) FREERTOS_SYSTEM_CALL;
 UBaseType_t MPU_uxTaskGetNumberOfTasks( void ) FREERTOS_SYSTEM_CALL;
+UBaseType_t MPU_uxTaskGetDeferredUnblockCount( void ) FREERTOS_SYSTEM_CALL;
 char * MPU_pcTaskGetName( TaskHandle_t xTaskToQuery ) FREERTOS_SYSTEM_CALL;
 TaskHandle_t MPU_xTaskGetHandle( const char * pcNameToQuery ) FREERTOS_SYSTEM_CALL;
 UBaseType_t MPU_uxTaskGetStackHighWaterMark( TaskHandle_t xTask ) FREERTOS_SYSTEM_CALL;
@@ -126,6 +127,14 @@ BaseType_t MPU_xQueueGenericSend( QueueHandle_t xQueue,
 BaseType_t MPU_xQueueReceive( QueueHandle_t xQueue,
                               void * const pvBuffer,
                               TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+UBaseType_t MPU_uxQueueSendMultiple( QueueHandle_t xQueue,
+                                     const void * const pvItemsToQueue,
+                                     const UBaseType_t uxItemCount,
+                                     TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+UBaseType_t MPU_uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                        void * const pvBuffer,
+                                        const UBaseType_t uxMaxItems,
+                                        TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xQueuePeek( QueueHandle_t xQueue,
                            void * const pvBuffer,
                            TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
@@ -158,6 +167,36 @@ QueueHandle_t MPU_xQueueGenericCreateStatic( const UBaseType_t uxQueueLength,
                                              uint8_t * pucQueueStorage,
                                              StaticQueue_t * pxStaticQueue,
                                              const uint8_t ucQueueType ) FREERTOS_SYSTEM_CALL;
+QueueHandle_t MPU_xQueueCreateBufferQueue( const UBaseType_t uxBufferCount,
+                                           const UBaseType_t uxBufferSize ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xQueueAcquireBuffer( QueueHandle_t xQueue,
+                                    void ** ppvBuffer,
+                                    TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xQueueSendBuffer( QueueHandle_t xQueue,
+                                 void * pvBuffer ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xQueueReceiveBuffer( QueueHandle_t xQueue,
+                                    void ** ppvBuffer,
+                                    TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xQueueReleaseBuffer( QueueHandle_t xQueue,
+                                    void * pvBuffer ) FREERTOS_SYSTEM_CALL;
+PoolHandle_t MPU_xPoolCreateStatic( size_t xBlockSize,
+                                    UBaseType_t uxBlockCount,
+                                    uint8_t * pucPoolStorage,
+                                    StaticPool_t * pxPoolBuffer ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xPoolAlloc( PoolHandle_t xPool,
+                           void ** ppvBlock,
+                           TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xPoolFree( PoolHandle_t xPool,
+                          void * pvBlock ) FREERTOS_SYSTEM_CALL;
+NotifyQueueHandle_t MPU_xNotifyQueueCreateStatic( UBaseType_t uxLength,
+                                                  uint32_t * pulStorage,
+                                                  StaticNotifyQueue_t * pxNotifyQueueBuffer ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xNotifyQueueSend( NotifyQueueHandle_t xNotifyQueue,
+                                 uint32_t ulEvent ) FREERTOS_SYSTEM_CALL;
+BaseType_t MPU_xNotifyQueueReceive( NotifyQueueHandle_t xNotifyQueue,
+                                    uint32_t * pulEvent,
+                                    TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
+UBaseType_t MPU_uxNotifyQueueMessagesWaiting( NotifyQueueHandle_t xNotifyQueue ) FREERTOS_SYSTEM_CALL;
 QueueSetHandle_t MPU_xQueueCreateSet( const UBaseType_t uxEventQueueLength ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore,
                                QueueSetHandle_t xQueueSet ) FREERTOS_SYSTEM_CALL;
@@ -184,11 +223,36 @@ TimerHandle_t MPU_xTimerCreateStatic( const char * const pcTimerName,
                                       void * const pvTimerID,
                                       TimerCallbackFunction_t pxCallbackFunction,
                                       StaticTimer_t * pxTimerBuffer ) FREERTOS_SYSTEM_CALL;
+TimerHandle_t MPU_xTimerCreateFast( const char * const pcTimerName,
+                                    const TickType_t xTimerPeriodInTicks,
+                                    const UBaseType_t uxAutoReload,
+                                    void * const pvTimerID,
+                                    TimerCallbackFunction_t pxCallbackFunction ) FREERTOS_SYSTEM_CALL;
+TimerHandle_t MPU_xTimerCreateFastStatic( const char * const pcTimerName,
+                                          const TickType_t xTimerPeriodInTicks,
+                                          const UBaseType_t uxAutoReload,
+                                          void * const pvTimerID,
+                                          TimerCallbackFunction_t pxCallbackFunction,
+                                          StaticTimer_t * pxTimerBuffer ) FREERTOS_SYSTEM_CALL;
+TimerHandle_t MPU_xTimerCreateOnService( const char * const pcTimerName,
+                                         const TickType_t xTimerPeriodInTicks,
+                                         const UBaseType_t uxAutoReload,
+                                         void * const pvTimerID,
+                                         TimerCallbackFunction_t pxCallbackFunction,
+                                         const UBaseType_t uxService ) FREERTOS_SYSTEM_CALL;
+TimerHandle_t MPU_xTimerCreateStaticOnService( const char * const pcTimerName,
+                                               const TickType_t xTimerPeriodInTicks,
+                                               const UBaseType_t uxAutoReload,
+                                               void * const pvTimerID,
+                                               TimerCallbackFunction_t pxCallbackFunction,
+                                               StaticTimer_t * pxTimerBuffer,
+                                               const UBaseType_t uxService ) FREERTOS_SYSTEM_CALL;
 void * MPU_pvTimerGetTimerID( const TimerHandle_t xTimer ) FREERTOS_SYSTEM_CALL;
 void MPU_vTimerSetTimerID( TimerHandle_t xTimer,
                            void * pvNewID ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xTimerIsTimerActive( TimerHandle_t xTimer ) FREERTOS_SYSTEM_CALL;
 TaskHandle_t MPU_xTimerGetTimerDaemonTaskHandle( void ) FREERTOS_SYSTEM_CALL;
+TaskHandle_t MPU_xTimerGetServiceTaskHandle( const UBaseType_t uxService ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xTimerPendFunctionCall( PendedFunction_t xFunctionToPend,
                                        void * pvParameter1,
                                        uint32_t ulParameter2,
@@ -235,6 +299,15 @@ size_t MPU_xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
                                  size_t xBufferLengthBytes,
                                  TickType_t xTicksToWait ) FREERTOS_SYSTEM_CALL;
 size_t MPU_xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer ) FREERTOS_SYSTEM_CALL;
+size_t MPU_xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                                 void ** ppvData,
+                                 size_t xDataLengthBytes ) FREERTOS_SYSTEM_CALL;
+size_t MPU_xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes ) FREERTOS_SYSTEM_CALL;
+size_t MPU_xStreamBufferPeekContiguous( StreamBufferHandle_t xStreamBuffer,
+                                        void ** ppvData ) FREERTOS_SYSTEM_CALL;
+size_t MPU_xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes ) FREERTOS_SYSTEM_CALL;
 void MPU_vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer ) FREERTOS_SYSTEM_CALL;
 BaseType_t MPU_xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer ) FREERTOS_SYSTEM_CALL;
@@ -251,6 +324,12 @@ StreamBufferHandle_t MPU_xStreamBufferGenericCreateStatic( size_t xBufferSizeByt
                                                            BaseType_t xIsMessageBuffer,
                                                            uint8_t * const pucStreamBufferStorageArea,
                                                            StaticStreamBuffer_t * const pxStaticStreamBuffer ) FREERTOS_SYSTEM_CALL;
+StreamBufferHandle_t MPU_xStreamBufferGenericCreateChannel( size_t xBufferSizeBytes,
+                                                            size_t xTriggerLevelBytes,
+                                                            BaseType_t xIsMessageBuffer,
+                                                            uint8_t * const pucStreamBufferStorageArea,
+                                                            StaticStreamBuffer_t * const pxStaticStreamBuffer ) FREERTOS_SYSTEM_CALL;
+StreamBufferHandle_t MPU_xStreamBufferOpenChannel( StaticStreamBuffer_t * const pxStaticStreamBuffer ) FREERTOS_SYSTEM_CALL;
 
 
 
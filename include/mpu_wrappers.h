@@ -61,6 +61,7 @@
         #define xTaskResumeAll                         MPU_xTaskResumeAll
         #define xTaskGetTickCount                      MPU_xTaskGetTickCount
         #define uxTaskGetNumberOfTasks                 MPU_uxTaskGetNumberOfTasks
+        #define uxTaskGetDeferredUnblockCount          MPU_uxTaskGetDeferredUnblockCount
         #define pcTaskGetName                          MPU_pcTaskGetName
         #define xTaskGetHandle                         MPU_xTaskGetHandle
         #define uxTaskGetStackHighWaterMark            MPU_uxTaskGetStackHighWaterMark
@@ -90,6 +91,8 @@
 /* Map standard queue.h API functions to the MPU equivalents. */
         #define xQueueGenericSend                      MPU_xQueueGenericSend
         #define xQueueReceive                          MPU_xQueueReceive
+        #define uxQueueSendMultiple                    MPU_uxQueueSendMultiple
+        #define uxQueueReceiveMultiple                 MPU_uxQueueReceiveMultiple
         #define xQueuePeek                             MPU_xQueuePeek
         #define xQueueSemaphoreTake                    MPU_xQueueSemaphoreTake
         #define uxQueueMessagesWaiting                 MPU_uxQueueMessagesWaiting
@@ -109,6 +112,18 @@
         #define xQueueRemoveFromSet                    MPU_xQueueRemoveFromSet
         #define xQueueSelectFromSet                    MPU_xQueueSelectFromSet
         #define xQueueGenericReset                     MPU_xQueueGenericReset
+        #define xQueueCreateBufferQueue                MPU_xQueueCreateBufferQueue
+        #define xQueueAcquireBuffer                    MPU_xQueueAcquireBuffer
+        #define xQueueSendBuffer                       MPU_xQueueSendBuffer
+        #define xQueueReceiveBuffer                    MPU_xQueueReceiveBuffer
+        #define xQueueReleaseBuffer                    MPU_xQueueReleaseBuffer
+        #define xPoolCreateStatic                      MPU_xPoolCreateStatic
+        #define xPoolAlloc                             MPU_xPoolAlloc
+        #define xPoolFree                              MPU_xPoolFree
+        #define xNotifyQueueCreateStatic               MPU_xNotifyQueueCreateStatic
+        #define xNotifyQueueSend                       MPU_xNotifyQueueSend
+        #define xNotifyQueueReceive                    MPU_xNotifyQueueReceive
+        #define uxNotifyQueueMessagesWaiting           MPU_uxNotifyQueueMessagesWaiting
 
         #if ( configQUEUE_REGISTRY_SIZE > 0 )
             #define vQueueAddToRegistry                MPU_vQueueAddToRegistry
@@ -119,10 +134,15 @@
 /* Map standard timer.h API functions to the MPU equivalents. */
         #define xTimerCreate                           MPU_xTimerCreate
         #define xTimerCreateStatic                     MPU_xTimerCreateStatic
+        #define xTimerCreateFast                       MPU_xTimerCreateFast
+        #define xTimerCreateFastStatic                 MPU_xTimerCreateFastStatic
+        #define xTimerCreateOnService                  MPU_xTimerCreateOnService
+        #define xTimerCreateStaticOnService            MPU_xTimerCreateStaticOnService
         #define pvTimerGetTimerID                      MPU_pvTimerGetTimerID
         #define vTimerSetTimerID                       MPU_vTimerSetTimerID
         #define xTimerIsTimerActive                    MPU_xTimerIsTimerActive
         #define xTimerGetTimerDaemonTaskHandle         MPU_xTimerGetTimerDaemonTaskHandle
+        #define xTimerGetServiceTaskHandle             MPU_xTimerGetServiceTaskHandle
         #define xTimerPendFunctionCall                 MPU_xTimerPendFunctionCall
         #define pcTimerGetName                         MPU_pcTimerGetName
         #define vTimerSetReloadMode                    MPU_vTimerSetReloadMode
@@ -145,6 +165,10 @@
         #define xStreamBufferSend                      MPU_xStreamBufferSend
         #define xStreamBufferReceive                   MPU_xStreamBufferReceive
         #define xStreamBufferNextMessageLengthBytes    MPU_xStreamBufferNextMessageLengthBytes
+        #define xStreamBufferReserve                   MPU_xStreamBufferReserve
+        #define xStreamBufferCommit                    MPU_xStreamBufferCommit
+        #define xStreamBufferPeekContiguous            MPU_xStreamBufferPeekContiguous
+        #define xStreamBufferConsume                   MPU_xStreamBufferConsume
         #define vStreamBufferDelete                    MPU_vStreamBufferDelete
         #define xStreamBufferIsFull                    MPU_xStreamBufferIsFull
         #define xStreamBufferIsEmpty                   MPU_xStreamBufferIsEmpty
@@ -154,6 +178,8 @@
         #define xStreamBufferSetTriggerLevel           MPU_xStreamBufferSetTriggerLevel
         #define xStreamBufferGenericCreate             MPU_xStreamBufferGenericCreate
         #define xStreamBufferGenericCreateStatic       MPU_xStreamBufferGenericCreateStatic
+        #define xStreamBufferGenericCreateChannel      MPU_xStreamBufferGenericCreateChannel
+        #define xStreamBufferOpenChannel               MPU_xStreamBufferOpenChannel
 
 
 /* Remove the privileged function macro, but keep the PRIVILEGED_DATA
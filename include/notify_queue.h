@@ -0,0 +1,134 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A notify queue passes 32 bit event codes from any number of interrupts and
+ * tasks to a single receiving task.  Posting an event does not mask interrupts
+ * or lock the kernel.  A slot is claimed with an atomic compare and swap from
+ * atomic.h, then the event is written and the slot published.  Only when the
+ * receiving task is blocked on an empty queue does the poster also notify it
+ * with a direct to task notification.  The implementation is in queue.c.
+ * configUSE_NOTIFY_QUEUES must be set to 1 in FreeRTOSConfig.h for notify
+ * queues to be available.
+ *
+ * Only one task may receive from a given notify queue.  The receiving task
+ * blocks on its notification at index configNOTIFY_QUEUE_NOTIFICATION_INDEX,
+ * which defaults to the last index in the task's notification array.  Notify
+ * queues only use the notification state at that index, not its value, but a
+ * notification sent to the receiving task at that index can be missed.  Set
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES to at least 2 so the index is not the
+ * one used by xTaskNotify(), xTaskNotifyGive() and the stream buffers.
+ *
+ * An event that is posted while another poster has claimed an earlier slot but
+ * not yet published it is only received once the earlier event is published.
+ * Events from a single poster are always received in the order they were
+ * posted.
+ */
+
+#ifndef NOTIFY_QUEUE_H
+#define NOTIFY_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include notify_queue.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which notify queues are referenced.  For example, a call to
+ * xNotifyQueueCreateStatic() returns a NotifyQueueHandle_t variable that can
+ * then be used as a parameter to xNotifyQueueSendFromISR(),
+ * xNotifyQueueReceive(), etc.
+ */
+struct NotifyQueueDefinition;
+typedef struct NotifyQueueDefinition * NotifyQueueHandle_t;
+
+/*
+ * Creates a notify queue that can hold uxLength events, using the memory
+ * pointed to by pulStorage, which must be an array of at least
+ * ( uxLength * 2 ) uint32_t variables.  uxLength must be a power of two, and
+ * at least 2.
+ *
+ * pxNotifyQueueBuffer must point to a StaticNotifyQueue_t variable, which will
+ * be used to hold the notify queue's data structure.
+ *
+ * Returns the handle of the notify queue, which starts empty, or NULL if either
+ * pulStorage or pxNotifyQueueBuffer is NULL.  The memory used by a notify queue
+ * is supplied by the application, so there is no function to delete one.
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    NotifyQueueHandle_t xNotifyQueueCreateStatic( UBaseType_t uxLength,
+                                                  uint32_t * pulStorage,
+                                                  StaticNotifyQueue_t * pxNotifyQueueBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Posts the event ulEvent to the notify queue xNotifyQueue from a task.  This
+ * never blocks.  Returns pdPASS if the event was posted, or errQUEUE_FULL if the
+ * queue was full.
+ */
+BaseType_t xNotifyQueueSend( NotifyQueueHandle_t xNotifyQueue,
+                             uint32_t ulEvent ) PRIVILEGED_FUNCTION;
+
+/*
+ * A version of xNotifyQueueSend() that can be called from an ISR.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if posting the event unblocked the
+ * receiving task and that task has a priority above the interrupted task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  Interrupts are only masked if the receiving task has to be unblocked.
+ */
+BaseType_t xNotifyQueueSendFromISR( NotifyQueueHandle_t xNotifyQueue,
+                                    uint32_t ulEvent,
+                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Receives the oldest event from the notify queue xNotifyQueue into *pulEvent,
+ * waiting up to xTicksToWait for an event to be posted if the queue is empty.
+ * Returns pdPASS if an event was received, or pdFAIL if no event was posted in
+ * time.  Only one task may call this function for a given notify queue.
+ */
+BaseType_t xNotifyQueueReceive( NotifyQueueHandle_t xNotifyQueue,
+                                uint32_t * pulEvent,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of slots in the notify queue xNotifyQueue that have been
+ * claimed by posters and not yet received.  This includes the slots of events
+ * that are still being written.
+ */
+UBaseType_t uxNotifyQueueMessagesWaiting( NotifyQueueHandle_t xNotifyQueue ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( NOTIFY_QUEUE_H ) */
@@ -0,0 +1,146 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A memory pool hands out fixed size blocks from a buffer supplied by the
+ * application.  Allocating or freeing a block takes a constant time, and a task
+ * can block with a timeout on an empty pool in the same way it would block on an
+ * empty queue.  Pools are built on counting semaphores, so the implementation is
+ * in queue.c.  configUSE_POOLS must be set to 1 in FreeRTOSConfig.h for pools to
+ * be available.
+ *
+ * Setting configPOOL_CHECK_DOUBLE_FREE to 1 makes freeing a block that is
+ * already free fail instead of corrupting the pool.  The check walks the free
+ * list, so freeing then takes a time proportional to the number of free blocks.
+ *
+ * Free blocks are kept on a singly linked list that is threaded through the
+ * blocks themselves, so a pool needs no memory beyond the StaticPool_t structure
+ * and the blocks.  The first pointer sized word of a block is overwritten when
+ * the block is freed.
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include pool.h"
+#endif
+
+#include "queue.h"
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which memory pools are referenced.  For example, a call to
+ * xPoolCreateStatic() returns a PoolHandle_t variable that can then be used as
+ * a parameter to xPoolAlloc(), xPoolFree(), etc.
+ */
+struct PoolDefinition;
+typedef struct PoolDefinition * PoolHandle_t;
+
+/*
+ * Creates a pool of uxBlockCount blocks, each xBlockSize bytes, in the memory
+ * pointed to by pucPoolStorage, which must be at least
+ * ( xBlockSize * uxBlockCount ) bytes.  pucPoolStorage must be aligned to hold
+ * a pointer, and xBlockSize must be a non-zero multiple of sizeof( void * ), so
+ * every block can hold the free list link.  To get blocks with a stricter
+ * alignment align pucPoolStorage and round xBlockSize up to match.
+ *
+ * pxPoolBuffer must point to a StaticPool_t variable, which will be used to
+ * hold the pool's data structure.
+ *
+ * Returns the handle of the pool, which starts with every block free, or NULL
+ * if either pucPoolStorage or pxPoolBuffer is NULL.
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    PoolHandle_t xPoolCreateStatic( size_t xBlockSize,
+                                    UBaseType_t uxBlockCount,
+                                    uint8_t * pucPoolStorage,
+                                    StaticPool_t * pxPoolBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Takes a block from the pool xPool, waiting up to xTicksToWait for a block to
+ * be freed if none are free.  Returns pdPASS and sets *ppvBlock to the block,
+ * or returns pdFAIL and sets *ppvBlock to NULL if no block became free in time.
+ * Tasks waiting on the same pool are served in priority order.
+ */
+BaseType_t xPoolAlloc( PoolHandle_t xPool,
+                       void ** ppvBlock,
+                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * A version of xPoolAlloc() that can be called from an ISR.  It never blocks.
+ * Freeing a block never has to wait, so taking a block can not unblock a task
+ * and *pxHigherPriorityTaskWoken is left unchanged.  The parameter is kept for
+ * consistency with xPoolFreeFromISR().
+ */
+BaseType_t xPoolAllocFromISR( PoolHandle_t xPool,
+                              void ** ppvBlock,
+                              BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pvBlock, which must have been obtained from the same pool, to the
+ * pool.  If a task is blocked waiting for a block it is unblocked.  This never
+ * blocks.  Returns pdPASS.  If configPOOL_CHECK_DOUBLE_FREE is 1 and pvBlock is
+ * already free, configASSERT() is called and pdFAIL is returned.
+ */
+BaseType_t xPoolFree( PoolHandle_t xPool,
+                      void * pvBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * A version of xPoolFree() that can be called from an ISR.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if freeing the block unblocked a
+ * task that has a higher priority than the interrupted task, in which case a
+ * context switch should be requested before the interrupt is exited.
+ */
+BaseType_t xPoolFreeFromISR( PoolHandle_t xPool,
+                             void * pvBlock,
+                             BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of blocks that are currently free in the pool xPool.
+ */
+#define uxPoolGetFreeBlockCount( xPool )    uxQueueMessagesWaiting( ( QueueHandle_t ) ( xPool ) )
+
+/*
+ * Deletes the pool xPool.  No task may be blocked on the pool when it is
+ * deleted.  The pool's memory was supplied by the application, so is not
+ * freed.
+ */
+#define vPoolDelete( xPool )                vQueueDelete( ( QueueHandle_t ) ( xPool ) )
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( POOL_H ) */
@@ -74,6 +74,8 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_COUNTING_SEMAPHORE    ( ( uint8_t ) 2U )
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE      ( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX       ( ( uint8_t ) 4U )
+#define queueQUEUE_TYPE_BUFFER_QUEUE          ( ( uint8_t ) 5U )
+#define queueQUEUE_TYPE_POOL                  ( ( uint8_t ) 6U )
 
 /**
  * queue. h
@@ -883,6 +885,110 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ * UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+ *                                  const void * const pvItemsToQueue,
+ *                                  const UBaseType_t uxItemCount,
+ *                                  TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Post up to uxItemCount items to the back of a queue in a single operation.
+ * The items are copied, in order, from the array pointed to by pvItemsToQueue.
+ * As many items as there is room for are posted, so the call only blocks if the
+ * queue is full, and returns as soon as at least one item can be posted.  Tasks
+ * waiting to receive are woken, and a context switch is requested, once for
+ * the whole batch rather than once for each item.
+ *
+ * This function must not be used in an interrupt service routine, or on a
+ * semaphore or mutex.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of items to be placed on the
+ * queue.  Each item is the size defined when the queue was created.
+ *
+ * @param uxItemCount The number of items in the array pointed to by
+ * pvItemsToQueue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for space to become available on the queue, should it already be full.  The
+ * call will return immediately if this is set to 0.
+ *
+ * @return The number of items posted, which is 0 if the queue remained full
+ * for the whole of xTicksToWait.
+ *
+ * \defgroup uxQueueSendMultiple uxQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+                                 const void * const pvItemsToQueue,
+                                 const UBaseType_t uxItemCount,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ * UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+ *                                     void * const pvBuffer,
+ *                                     const UBaseType_t uxMaxItems,
+ *                                     TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Receive up to uxMaxItems items from a queue in a single operation.  The items
+ * are copied, in order, into the array pointed to by pvBuffer and removed from
+ * the queue.  As many items as are available are received, so the call only
+ * blocks if the queue is empty, and returns as soon as at least one item is
+ * available.  Tasks waiting to send are woken, and a context switch is
+ * requested, once for the whole batch rather than once for each item.
+ *
+ * This function must not be used in an interrupt service routine, or on a
+ * semaphore or mutex.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the array into which the received items will be
+ * copied.  It must be large enough to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive should the queue be empty at the time of the call.
+ * The call will return immediately if this is set to 0.
+ *
+ * @return The number of items received, which is 0 if the queue remained empty
+ * for the whole of xTicksToWait.
+ *
+ * Example use:
+ * <pre>
+ * void vADrainingTask( void *pvParameters )
+ * {
+ * uint32_t ulDescriptors[ 32 ];
+ * UBaseType_t uxReceived, ux;
+ *
+ *  for( ;; )
+ *  {
+ *      // Wait for at least one descriptor, then take every descriptor that
+ *      // is available, up to 32, in one go.
+ *      uxReceived = uxQueueReceiveMultiple( xQueue, ulDescriptors, 32, portMAX_DELAY );
+ *
+ *      for( ux = 0; ux < uxReceived; ux++ )
+ *      {
+ *          // Process ulDescriptors[ ux ] here.
+ *      }
+ *  }
+ * }
+ * </pre>
+ * \defgroup uxQueueReceiveMultiple uxQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                    void * const pvBuffer,
+                                    const UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * <pre>
@@ -1695,6 +1801,61 @@ QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet,
  */
 QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
 
+/*
+ * A buffer queue passes fixed size buffers between tasks by reference rather
+ * than by copy.  It combines a pool of uxBufferCount buffers, each
+ * uxBufferSize bytes, with a queue that holds pointers to those buffers.
+ * configUSE_BUFFER_QUEUES must be set to 1 in FreeRTOSConfig.h for buffer
+ * queues to be available.
+ *
+ * The sender obtains a free buffer from the pool with xQueueAcquireBuffer(),
+ * fills it, then passes it to the receiver with xQueueSendBuffer().  The
+ * receiver obtains the buffer with xQueueReceiveBuffer() and, once it has
+ * finished with it, returns it to the pool with xQueueReleaseBuffer().  A task
+ * that holds a buffer owns it until it sends or releases it.
+ *
+ * The buffers are allocated along with the queue and freed by vQueueDelete(),
+ * so there is no allocation after xQueueCreateBufferQueue() returns.
+ */
+#if ( ( configUSE_BUFFER_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreateBufferQueue( const UBaseType_t uxBufferCount,
+                                           const UBaseType_t uxBufferSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Takes a buffer from the pool of the buffer queue xQueue, waiting up to
+ * xTicksToWait for one to be released if all are in use.  Returns pdPASS and
+ * sets *ppvBuffer to the buffer, or returns errQUEUE_EMPTY if no buffer became
+ * free in time.
+ */
+BaseType_t xQueueAcquireBuffer( QueueHandle_t xQueue,
+                                void ** ppvBuffer,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sends pvBuffer, which must have been obtained from xQueueAcquireBuffer() on
+ * the same buffer queue, to the back of the queue.  There are only as many
+ * buffers as the queue can hold, so this never blocks.
+ */
+BaseType_t xQueueSendBuffer( QueueHandle_t xQueue,
+                             void * pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Receives the buffer at the front of the buffer queue xQueue, waiting up to
+ * xTicksToWait for one to be sent.  Returns pdPASS and sets *ppvBuffer to the
+ * buffer, or returns errQUEUE_EMPTY if no buffer was sent in time.
+ */
+BaseType_t xQueueReceiveBuffer( QueueHandle_t xQueue,
+                                void ** ppvBuffer,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pvBuffer, which must have been obtained from the same buffer queue,
+ * to the pool so it can be acquired again.  This never blocks.
+ */
+BaseType_t xQueueReleaseBuffer( QueueHandle_t xQueue,
+                                void * pvBuffer ) PRIVILEGED_FUNCTION;
+
 /* Not public API functions. */
 void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
                                      TickType_t xTicksToWait,
@@ -45,6 +45,11 @@
  * (such as xStreamBufferReceive()) inside a critical section section and set the
  * receive block time to 0.
  *
+ * If configUSE_STREAM_BUFFER_FAST_PATH is set to 1 in FreeRTOSConfig.h then the
+ * writer and reader only lock the kernel when the other end of the buffer is
+ * blocked, so sending to and receiving from a buffer that is neither empty nor
+ * full does not enter a critical section or suspend the scheduler.
+ *
  */
 
 #ifndef STREAM_BUFFER_H
@@ -219,6 +224,141 @@ typedef struct StreamBufferDef_t * StreamBufferHandle_t;
 #define xStreamBufferCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) \
     xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pdFALSE, pucStreamBufferStorageArea, pxStaticStreamBuffer )
 
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * StreamBufferHandle_t xStreamBufferCreateChannel( size_t xBufferSizeBytes,
+ *                                               size_t xTriggerLevelBytes,
+ *                                               uint8_t *pucStreamBufferStorageArea,
+ *                                               StaticStreamBuffer_t *pxStaticStreamBuffer );
+ * </pre>
+ * Creates a stream buffer that is used as a channel between two kernel
+ * instances, for example two independent FreeRTOS images running on the two
+ * cores of an asymmetric multiprocessing (AMP) device.  One task on one
+ * instance writes to the channel and one task on the other instance reads from
+ * it.  Either task can block on the channel as it would on any other stream
+ * buffer.
+ *
+ * Both pucStreamBufferStorageArea and pxStaticStreamBuffer must be in memory
+ * shared by the two instances, at the same address in both.  The channel is
+ * created by one instance only.  The other instance obtains a handle to it by
+ * passing the same pxStaticStreamBuffer to xStreamBufferOpenChannel().
+ *
+ * A channel's task handles belong to one instance or the other, so the
+ * notifications normally sent by sbSEND_COMPLETED() and sbRECEIVE_COMPLETED()
+ * cannot be sent across instances.  Instead, writing to a channel calls
+ * sbCHANNEL_SEND_COMPLETED( xStreamBuffer ) and reading from a channel calls
+ * sbCHANNEL_RECEIVE_COMPLETED( xStreamBuffer ).  Both must be defined in
+ * FreeRTOSConfig.h to ring a doorbell, such as an inter-processor interrupt, on
+ * the other instance.  The doorbell interrupt handler calls
+ * xStreamBufferSendCompletedFromISR() or xStreamBufferReceiveCompletedFromISR()
+ * respectively to unblock the task on its own instance.  Both macros can be
+ * called from task and interrupt context.
+ *
+ * If the cores can observe each other's writes out of order then also define
+ * sbCHANNEL_MEMORY_BARRIER() to a hardware memory barrier.  It defaults to
+ * portMEMORY_BARRIER().
+ *
+ * configUSE_STREAM_BUFFER_CHANNELS and configSUPPORT_STATIC_ALLOCATION must be
+ * set to 1 in FreeRTOSConfig.h for xStreamBufferCreateChannel() to be
+ * available.
+ *
+ * @param xBufferSizeBytes The size, in bytes, of the buffer pointed to by the
+ * pucStreamBufferStorageArea parameter.
+ *
+ * @param xTriggerLevelBytes As for xStreamBufferCreateStatic().
+ *
+ * @param pucStreamBufferStorageArea Must point to a uint8_t array in shared
+ * memory that is at least xBufferSizeBytes + 1 big.
+ *
+ * @param pxStaticStreamBuffer Must point to a variable of type
+ * StaticStreamBuffer_t in shared memory, which will be used to hold the
+ * channel's data structure.
+ *
+ * @return If the channel is created successfully then a handle to the created
+ * channel is returned. If either pucStreamBufferStorageArea or
+ * pxStaticstreamBuffer are NULL then NULL is returned.
+ *
+ * Example use:
+ * <pre>
+ *
+ * // In FreeRTOSConfig.h of both images.  vGenerateCoreInterrupt() is
+ * // application defined and raises an interrupt on the other core.
+ * #define sbCHANNEL_SEND_COMPLETED( xChannel )       vGenerateCoreInterrupt( xChannel, pdTRUE )
+ * #define sbCHANNEL_RECEIVE_COMPLETED( xChannel )    vGenerateCoreInterrupt( xChannel, pdFALSE )
+ *
+ * // Placed in shared memory by the linker script of both images.
+ * StaticStreamBuffer_t xChannelStruct;
+ * uint8_t ucChannelStorage[ 1000 ];
+ *
+ * // On the first core.
+ * void vCreateChannel( void )
+ * {
+ * StreamBufferHandle_t xChannel;
+ *
+ *  xChannel = xStreamBufferCreateChannel( sizeof( ucChannelStorage ),
+ *                                         1,
+ *                                         ucChannelStorage,
+ *                                         &xChannelStruct );
+ * }
+ *
+ * // On the second core, once the first core has created the channel.
+ * void vOpenChannel( void )
+ * {
+ * StreamBufferHandle_t xChannel;
+ *
+ *  xChannel = xStreamBufferOpenChannel( &xChannelStruct );
+ * }
+ *
+ * // The doorbell interrupt handler on either core.
+ * void vCoreInterruptHandler( StreamBufferHandle_t xChannel, BaseType_t xDataWritten )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  if( xDataWritten != pdFALSE )
+ *  {
+ *      xStreamBufferSendCompletedFromISR( xChannel, &xHigherPriorityTaskWoken );
+ *  }
+ *  else
+ *  {
+ *      xStreamBufferReceiveCompletedFromISR( xChannel, &xHigherPriorityTaskWoken );
+ *  }
+ *
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * </pre>
+ * \defgroup xStreamBufferCreateChannel xStreamBufferCreateChannel
+ * \ingroup StreamBufferManagement
+ */
+#define xStreamBufferCreateChannel( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) \
+    xStreamBufferGenericCreateChannel( xBufferSizeBytes, xTriggerLevelBytes, pdFALSE, pucStreamBufferStorageArea, pxStaticStreamBuffer )
+
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * StreamBufferHandle_t xStreamBufferOpenChannel( StaticStreamBuffer_t *pxStaticStreamBuffer );
+ * </pre>
+ * Obtains a handle to a channel created by another kernel instance using
+ * xStreamBufferCreateChannel() or xMessageBufferCreateChannel().  The channel
+ * is not initialised again.
+ *
+ * configUSE_STREAM_BUFFER_CHANNELS and configSUPPORT_STATIC_ALLOCATION must be
+ * set to 1 in FreeRTOSConfig.h for xStreamBufferOpenChannel() to be available.
+ *
+ * @param pxStaticStreamBuffer The shared StaticStreamBuffer_t variable that
+ * was passed to xStreamBufferCreateChannel() by the other instance.
+ *
+ * @return A handle to the channel, or NULL if the other instance has not
+ * created the channel yet.
+ *
+ * \defgroup xStreamBufferOpenChannel xStreamBufferOpenChannel
+ * \ingroup StreamBufferManagement
+ */
+StreamBufferHandle_t xStreamBufferOpenChannel( StaticStreamBuffer_t * const pxStaticStreamBuffer ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -592,6 +732,234 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
                                     size_t xBufferLengthBytes,
                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+ *                           void **ppvData,
+ *                           size_t xDataLengthBytes );
+ * </pre>
+ *
+ * Obtains a pointer to free space in a stream buffer's storage area, so the
+ * data can be written in place, for example by a DMA engine, rather than being
+ * copied in by xStreamBufferSend().  The data is not visible to the reader
+ * until it is committed with xStreamBufferCommit() or
+ * xStreamBufferCommitFromISR().  Only the writer can call this function, and
+ * it can be called from a task or an interrupt.  It never blocks.
+ *
+ * If xStreamBuffer is a stream buffer the space returned may be less than
+ * xDataLengthBytes, either because the buffer does not have enough space or
+ * because the space wraps past the end of the storage area.  If xStreamBuffer
+ * is a message buffer then space for the whole message is returned or no space
+ * is returned.  A message that would wrap past the end of the storage area
+ * cannot be reserved, and must be sent with xMessageBufferSend() instead.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param ppvData Set to the start of the reserved space, or to NULL if no
+ * space was reserved.
+ *
+ * @param xDataLengthBytes The number of bytes wanted.
+ *
+ * @return The number of contiguous bytes reserved at *ppvData.
+ *
+ * Example use:
+ * <pre>
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * void *pvSpace;
+ * size_t xReserved;
+ *
+ *  xReserved = xStreamBufferReserve( xStreamBuffer, &pvSpace, 64 );
+ *
+ *  if( xReserved > 0 )
+ *  {
+ *      // Fill up to xReserved bytes at pvSpace, then make the bytes that
+ *      // were written visible to the reader.
+ *      xStreamBufferCommit( xStreamBuffer, xReserved );
+ *  }
+ * }
+ * </pre>
+ * \defgroup xStreamBufferReserve xStreamBufferReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                             void ** ppvData,
+                             size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+ *                          size_t xDataLengthBytes );
+ * </pre>
+ *
+ * Makes data written in place after a call to xStreamBufferReserve() visible
+ * to the reader, unblocking the reader if it is waiting for data.
+ *
+ * Use xStreamBufferCommit() to commit data from a task.  Use
+ * xStreamBufferCommitFromISR() to commit data from an interrupt service
+ * routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param xDataLengthBytes The number of bytes written in place.  If
+ * xStreamBuffer is a stream buffer this can be less than the number of bytes
+ * reserved.  If xStreamBuffer is a message buffer this is the length of the
+ * message, and must not be more than the number of bytes reserved.
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferCommit xStreamBufferCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+                            size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                 size_t xDataLengthBytes,
+ *                                 BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * An interrupt safe version of xStreamBufferCommit().
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param xDataLengthBytes The number of bytes written in place, as for
+ * xStreamBufferCommit().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the data
+ * unblocked a task that has a priority above the currently executing task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  See the documentation for xStreamBufferSendFromISR().
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferCommitFromISR xStreamBufferCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                   size_t xDataLengthBytes,
+                                   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * size_t xStreamBufferPeekContiguous( StreamBufferHandle_t xStreamBuffer,
+ *                                  void **ppvData );
+ * </pre>
+ *
+ * Obtains a pointer to the data in a stream buffer's storage area, so the data
+ * can be processed in place rather than being copied out by
+ * xStreamBufferReceive().  The data stays in the buffer until it is released
+ * with xStreamBufferConsume() or xStreamBufferConsumeFromISR().  Only the
+ * reader can call this function, and it can be called from a task or an
+ * interrupt.  It never blocks, so a task that wants to wait for data should
+ * first wait for a notification from the writer or poll.
+ *
+ * If xStreamBuffer is a stream buffer the data returned stops at the end of the
+ * storage area, and the rest can be obtained by another call once the first
+ * part has been consumed.  If xStreamBuffer is a message buffer the next whole
+ * message is returned.  A message that wraps past the end of the storage area
+ * cannot be peeked, and must be received with xMessageBufferReceive() instead.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param ppvData Set to the start of the data, or to NULL if there is no data
+ * that can be returned.
+ *
+ * @return The number of contiguous bytes available at *ppvData.
+ *
+ * Example use:
+ * <pre>
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * void *pvData;
+ * size_t xLength;
+ *
+ *  xLength = xStreamBufferPeekContiguous( xStreamBuffer, &pvData );
+ *
+ *  if( xLength > 0 )
+ *  {
+ *      // Process xLength bytes at pvData, then release them to the writer.
+ *      xStreamBufferConsume( xStreamBuffer, xLength );
+ *  }
+ * }
+ * </pre>
+ * \defgroup xStreamBufferPeekContiguous xStreamBufferPeekContiguous
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferPeekContiguous( StreamBufferHandle_t xStreamBuffer,
+                                    void ** ppvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * size_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+ *                           size_t xDataLengthBytes );
+ * </pre>
+ *
+ * Releases data obtained by a call to xStreamBufferPeekContiguous() back to
+ * the writer, unblocking the writer if it is waiting for space.
+ *
+ * Use xStreamBufferConsume() to release data from a task.  Use
+ * xStreamBufferConsumeFromISR() to release data from an interrupt service
+ * routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param xDataLengthBytes The number of bytes to release.  If xStreamBuffer is
+ * a stream buffer this can be less than the number of bytes returned by
+ * xStreamBufferPeekContiguous().  If xStreamBuffer is a message buffer the
+ * whole message is released, and this must be the length returned by
+ * xStreamBufferPeekContiguous().
+ *
+ * @return The number of bytes released.
+ *
+ * \defgroup xStreamBufferConsume xStreamBufferConsume
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                             size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * <pre>
+ * size_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                  size_t xDataLengthBytes,
+ *                                  BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * An interrupt safe version of xStreamBufferConsume().
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param xDataLengthBytes The number of bytes to release, as for
+ * xStreamBufferConsume().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if releasing the data
+ * unblocked a task that has a priority above the currently executing task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  See the documentation for xStreamBufferReceiveFromISR().
+ *
+ * @return The number of bytes released.
+ *
+ * \defgroup xStreamBufferConsumeFromISR xStreamBufferConsumeFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xDataLengthBytes,
+                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -849,6 +1217,12 @@ StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes,
                                                        uint8_t * const pucStreamBufferStorageArea,
                                                        StaticStreamBuffer_t * const pxStaticStreamBuffer ) PRIVILEGED_FUNCTION;
 
+StreamBufferHandle_t xStreamBufferGenericCreateChannel( size_t xBufferSizeBytes,
+                                                        size_t xTriggerLevelBytes,
+                                                        BaseType_t xIsMessageBuffer,
+                                                        uint8_t * const pucStreamBufferStorageArea,
+                                                        StaticStreamBuffer_t * const pxStaticStreamBuffer ) PRIVILEGED_FUNCTION;
+
 size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
 
 #if ( configUSE_TRACE_FACILITY == 1 )
@@ -1455,6 +1455,24 @@ TickType_t xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
  */
 UBaseType_t uxTaskGetNumberOfTasks( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>UBaseType_t uxTaskGetDeferredUnblockCount( void );</PRE>
+ *
+ * configTICK_MAX_UNBLOCKS must be set to a value above 0 in FreeRTOSConfig.h
+ * for this function to be available.
+ *
+ * @return The number of tasks that were not moved out of the Blocked state by
+ * the tick interrupt of the tick on which their block time expired, because
+ * that tick interrupt had already moved configTICK_MAX_UNBLOCKS tasks.  Such
+ * tasks are moved by the next context switch or tick instead.  The count wraps
+ * when it overflows.
+ *
+ * \defgroup uxTaskGetDeferredUnblockCount uxTaskGetDeferredUnblockCount
+ * \ingroup TaskUtils
+ */
+UBaseType_t uxTaskGetDeferredUnblockCount( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>char *pcTaskGetName( TaskHandle_t xTaskToQuery );</PRE>
@@ -1644,6 +1662,27 @@ configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVIL
     void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
                                                StackType_t ** ppxIdleTaskStackBuffer,
                                                uint32_t * pulIdleTaskStackSize ); /*lint !e526 Symbol not defined as it is an application callback. */
+
+    #if ( configNUMBER_OF_CORES > 1 )
+
+        /**
+         * task.h
+         * <pre>void vApplicationGetPassiveIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer, StackType_t ** ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize, BaseType_t xPassiveIdleTaskIndex ) </pre>
+         *
+         * This function is used to provide statically allocated blocks of memory to FreeRTOS to hold the TCBs of the additional idle tasks created
+         * when configNUMBER_OF_CORES is greater than 1.  It is called once for each core other than the first, with xPassiveIdleTaskIndex ranging
+         * from 0 to ( configNUMBER_OF_CORES - 2 ), and each call must provide a different block of memory.
+         *
+         * @param ppxIdleTaskTCBBuffer A handle to a statically allocated TCB buffer
+         * @param ppxIdleTaskStackBuffer A handle to a statically allocated Stack buffer for the idle task
+         * @param pulIdleTaskStackSize A pointer to the number of elements that will fit in the allocated stack buffer
+         * @param xPassiveIdleTaskIndex The index of the additional idle task the memory is for
+         */
+        void vApplicationGetPassiveIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                                   StackType_t ** ppxIdleTaskStackBuffer,
+                                                   uint32_t * pulIdleTaskStackSize,
+                                                   BaseType_t xPassiveIdleTaskIndex ); /*lint !e526 Symbol not defined as it is an application callback. */
+    #endif
 #endif
 
 /**
@@ -1671,6 +1710,20 @@ BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
  */
 TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * xTaskGetIdleTaskHandleForCore() is only available if
+ * INCLUDE_xTaskGetIdleTaskHandle is set to 1 and configNUMBER_OF_CORES is
+ * greater than 1 in FreeRTOSConfig.h.
+ *
+ * One idle task is created for each core.  Returns the handle of the idle
+ * task created for the core xCoreID, although idle tasks are not bound to the
+ * core they were created for.  Passing 0 is equivalent to calling
+ * xTaskGetIdleTaskHandle().
+ */
+#if ( configNUMBER_OF_CORES > 1 )
+    TaskHandle_t xTaskGetIdleTaskHandleForCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * configUSE_TRACE_FACILITY must be defined as 1 in FreeRTOSConfig.h for
  * uxTaskGetSystemState() to be available.
@@ -2895,6 +2948,22 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
                                      const TickType_t xItemValue,
                                      const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.
+ *
+ * A version of vTaskPlaceOnUnorderedEventList() used by event groups when
+ * configEVENT_GROUP_64BIT is 1.  ullItemValue is held in the task's TCB, as it
+ * does not fit in the event list item value.
+ */
+#if ( configEVENT_GROUP_64BIT == 1 )
+    void vTaskPlaceOnUnorderedEventList64( List_t * pxEventList,
+                                           const uint64_t ullItemValue,
+                                           const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -2938,6 +3007,42 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEG
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE EVENT BITS MODULE WHEN configEVENT_GROUP_64BIT IS 1.
+ *
+ * vTaskRemoveFromUnorderedEventList64() is the equivalent of
+ * vTaskRemoveFromUnorderedEventList() and must be called with the scheduler
+ * suspended.  ullTaskGetEventItemValue64() returns the value held for the task
+ * that owns pxEventListItem.
+ */
+#if ( configEVENT_GROUP_64BIT == 1 )
+    void vTaskRemoveFromUnorderedEventList64( ListItem_t * pxEventListItem,
+                                              const uint64_t ullItemValue ) PRIVILEGED_FUNCTION;
+    uint64_t ullTaskGetEventItemValue64( const ListItem_t * pxEventListItem ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE EVENT BITS MODULE WHEN configEVENT_GROUP_DIRECT_ISR IS 1.
+ *
+ * THESE FUNCTIONS MUST BE CALLED FROM A CRITICAL SECTION WITHIN AN ISR.
+ *
+ * Versions of vTaskRemoveFromUnorderedEventList() and
+ * vTaskRemoveFromUnorderedEventList64() that can be called whether or not the
+ * scheduler is suspended.  Return pdTRUE if the task being removed has a higher
+ * priority than the interrupted task, otherwise pdFALSE.
+ */
+#if ( configEVENT_GROUP_DIRECT_ISR == 1 )
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configEVENT_GROUP_DIRECT_ISR == 1 ) && ( configEVENT_GROUP_64BIT == 1 ) )
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR64( ListItem_t * pxEventListItem,
+                                                           const uint64_t ullItemValue ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -2946,7 +3051,11 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
  * Sets the pointer to the current TCB to the TCB of the highest priority task
  * that is ready to run.
  */
-portDONT_DISCARD void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
+#if ( configNUMBER_OF_CORES == 1 )
+    portDONT_DISCARD void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
+#else
+    portDONT_DISCARD void vTaskSwitchContext( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
@@ -2954,11 +3063,23 @@ portDONT_DISCARD void vTaskSwitchContext( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
 
+#if ( configEVENT_GROUP_64BIT == 1 )
+    uint64_t ullTaskResetEventItemValue64( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Return the handle of the calling task.
  */
 TaskHandle_t xTaskGetCurrentTaskHandle( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Return the handle of the task running on the core xCoreID.  Only available
+ * if configNUMBER_OF_CORES is greater than 1.
+ */
+#if ( configNUMBER_OF_CORES > 1 )
+    TaskHandle_t xTaskGetCurrentTaskHandleForCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Shortcut used by the queue implementation to prevent unnecessary call to
  * taskYIELD();
@@ -51,7 +51,10 @@
  * be used solely through the macros that make up the public software timer API,
  * as defined below.  The commands that are sent from interrupts must use the
  * highest numbers as tmrFIRST_FROM_ISR_COMMAND is used to determine if the task
- * or interrupt version of the queue send function should be used. */
+ * or interrupt version of the queue send function should be used.
+ * tmrCOMMAND_WAKE_DAEMON is only used when configTIMER_DIRECT_COMMANDS is 1, to
+ * make the timer service task re-evaluate its block time. */
+#define tmrCOMMAND_WAKE_DAEMON                  ( ( BaseType_t ) -3 )
 #define tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR    ( ( BaseType_t ) -2 )
 #define tmrCOMMAND_EXECUTE_CALLBACK             ( ( BaseType_t ) -1 )
 #define tmrCOMMAND_START_DONT_TRACE             ( ( BaseType_t ) 0 )
@@ -365,6 +368,123 @@ typedef void (* PendedFunction_t)( void *,
                                       StaticTimer_t * pxTimerBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * TimerHandle_t xTimerCreateFast(  const char * const pcTimerName,
+ *                                  TickType_t xTimerPeriodInTicks,
+ *                                  UBaseType_t uxAutoReload,
+ *                                  void * pvTimerID,
+ *                                  TimerCallbackFunction_t pxCallbackFunction );
+ *
+ * TimerHandle_t xTimerCreateFastStatic(  const char * const pcTimerName,
+ *                                        TickType_t xTimerPeriodInTicks,
+ *                                        UBaseType_t uxAutoReload,
+ *                                        void * pvTimerID,
+ *                                        TimerCallbackFunction_t pxCallbackFunction,
+ *                                        StaticTimer_t *pxTimerBuffer );
+ *
+ * Creates a fast timer.  The parameters and return value are the same as
+ * xTimerCreate() and xTimerCreateStatic() respectively.  configUSE_FAST_TIMERS
+ * must be set to 1 in FreeRTOSConfig.h for these functions to be available.
+ *
+ * A fast timer is not managed by the timer service task.  Its callback function
+ * is called from the tick interrupt, on the tick at which the timer expires,
+ * so it is not delayed by the priority of the timer service task.  The
+ * callback function must therefore be short, must not block, and must only
+ * call API functions that end in "FromISR".  It can pass NULL as the
+ * pxHigherPriorityTaskWoken parameter of those functions, as any context
+ * switch they make necessary is performed when the tick interrupt exits.
+ *
+ * Fast timers are started, stopped, reset, changed and deleted using the same
+ * API functions as other timers, but the commands are applied before the API
+ * function returns rather than being sent to the timer service task, so they
+ * never block and never fail because the timer command queue is full.
+ *
+ * Fast timers are kept in their own list, so they do not delay the processing
+ * of other timers, or each other's processing beyond the time taken to run the
+ * callback functions of the timers that expire on the same tick.
+ */
+#if ( configUSE_FAST_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    TimerHandle_t xTimerCreateFast( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                    const TickType_t xTimerPeriodInTicks,
+                                    const UBaseType_t uxAutoReload,
+                                    void * const pvTimerID,
+                                    TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_FAST_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    TimerHandle_t xTimerCreateFastStatic( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                          const TickType_t xTimerPeriodInTicks,
+                                          const UBaseType_t uxAutoReload,
+                                          void * const pvTimerID,
+                                          TimerCallbackFunction_t pxCallbackFunction,
+                                          StaticTimer_t * pxTimerBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * TimerHandle_t xTimerCreateOnService(  const char * const pcTimerName,
+ *                                       TickType_t xTimerPeriodInTicks,
+ *                                       UBaseType_t uxAutoReload,
+ *                                       void * pvTimerID,
+ *                                       TimerCallbackFunction_t pxCallbackFunction,
+ *                                       UBaseType_t uxService );
+ *
+ * TimerHandle_t xTimerCreateStaticOnService(  const char * const pcTimerName,
+ *                                             TickType_t xTimerPeriodInTicks,
+ *                                             UBaseType_t uxAutoReload,
+ *                                             void * pvTimerID,
+ *                                             TimerCallbackFunction_t pxCallbackFunction,
+ *                                             StaticTimer_t *pxTimerBuffer,
+ *                                             UBaseType_t uxService );
+ *
+ * Creates a timer that is managed by timer service uxService.  The other
+ * parameters and the return value are the same as xTimerCreate() and
+ * xTimerCreateStatic() respectively.  These functions are only available when
+ * configTIMER_SERVICE_COUNT is greater than 1 in FreeRTOSConfig.h.
+ *
+ * When configTIMER_SERVICE_COUNT is greater than 1 there are that many timer
+ * services, numbered from 0.  Each has its own timer service task, timer
+ * command queue and list of active timers, so a slow callback function only
+ * delays the other timers on the same timer service.  The task of timer service
+ * 0 runs at configTIMER_TASK_PRIORITY, and the task of timer service n runs at
+ * configTIMER_SERVICE_TASK_PRIORITY( n ).  Each command queue holds
+ * configTIMER_QUEUE_LENGTH commands, and each task has a stack of
+ * configTIMER_TASK_STACK_DEPTH words, except that the stack of the task of
+ * timer service 0 is provided by vApplicationGetTimerTaskMemory() when
+ * configSUPPORT_STATIC_ALLOCATION is 1.
+ *
+ * Timers created with xTimerCreate() or xTimerCreateStatic() are managed by
+ * timer service 0, which also runs the functions pended by
+ * xTimerPendFunctionCall() and xTimerPendFunctionCallFromISR().
+ *
+ * Example usage:
+ * @verbatim
+ * #define configTIMER_SERVICE_COUNT                     2
+ * #define configTIMER_SERVICE_TASK_PRIORITY( uxService )    ( configMAX_PRIORITIES - 1 )
+ *
+ * // Protocol timers are managed by timer service 1, so their callbacks are not
+ * // delayed by the callbacks of the housekeeping timers on timer service 0.
+ * xProtocolTimer = xTimerCreateOnService( "Retry", pdMS_TO_TICKS( 5 ), pdFALSE, NULL, vRetryCallback, 1 );
+ * @endverbatim
+ */
+#if ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    TimerHandle_t xTimerCreateOnService( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                         const TickType_t xTimerPeriodInTicks,
+                                         const UBaseType_t uxAutoReload,
+                                         void * const pvTimerID,
+                                         TimerCallbackFunction_t pxCallbackFunction,
+                                         const UBaseType_t uxService ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    TimerHandle_t xTimerCreateStaticOnService( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                               const TickType_t xTimerPeriodInTicks,
+                                               const UBaseType_t uxAutoReload,
+                                               void * const pvTimerID,
+                                               TimerCallbackFunction_t pxCallbackFunction,
+                                               StaticTimer_t * pxTimerBuffer,
+                                               const UBaseType_t uxService ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
  *
@@ -454,6 +574,19 @@ BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
  */
 TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * TaskHandle_t xTimerGetServiceTaskHandle( UBaseType_t uxService );
+ *
+ * Returns the handle of the task of timer service uxService.  Timer service 0
+ * is the timer service/daemon task returned by xTimerGetTimerDaemonTaskHandle().
+ * It is not valid to call xTimerGetServiceTaskHandle() before the scheduler has
+ * been started.  Only available when configTIMER_SERVICE_COUNT is greater
+ * than 1.
+ */
+#if ( configTIMER_SERVICE_COUNT > 1 )
+    TaskHandle_t xTimerGetServiceTaskHandle( const UBaseType_t uxService ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * BaseType_t xTimerStart( TimerHandle_t xTimer, TickType_t xTicksToWait );
  *
@@ -1318,6 +1451,22 @@ BaseType_t xTimerGenericCommand( TimerHandle_t xTimer,
                                  BaseType_t * const pxHigherPriorityTaskWoken,
                                  const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_FAST_TIMERS == 1 )
+
+    /*
+     * Called by xTaskIncrementTick() each time the tick count is incremented to
+     * call the callback functions of the fast timers that have expired.
+     */
+    void vTimerProcessFastTimers( const TickType_t xTickCount ) PRIVILEGED_FUNCTION;
+
+    /*
+     * Returns the time at which the next fast timer will expire, or
+     * portMAX_DELAY if no fast timer will expire before the tick count next
+     * overflows.  Used to limit the time for which the tick can be suppressed.
+     */
+    TickType_t xTimerGetNextFastExpireTime( void ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vTimerSetTimerNumber( TimerHandle_t xTimer,
                                UBaseType_t uxTimerNumber ) PRIVILEGED_FUNCTION;
@@ -41,6 +41,8 @@
 #include "timers.h"
 #include "event_groups.h"
 #include "stream_buffer.h"
+#include "pool.h"
+#include "notify_queue.h"
 #include "mpu_prototypes.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
@@ -300,6 +302,19 @@ UBaseType_t MPU_uxTaskGetNumberOfTasks( void ) /* FREERTOS_SYSTEM_CALL */
 }
 /*-----------------------------------------------------------*/
 
+#if ( configTICK_MAX_UNBLOCKS > 0 )
+    UBaseType_t MPU_uxTaskGetDeferredUnblockCount( void ) /* FREERTOS_SYSTEM_CALL */
+    {
+        UBaseType_t uxReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        uxReturn = uxTaskGetDeferredUnblockCount();
+        vPortResetPrivilege( xRunningPrivileged );
+        return uxReturn;
+    }
+#endif
+/*-----------------------------------------------------------*/
+
 char * MPU_pcTaskGetName( TaskHandle_t xTaskToQuery ) /* FREERTOS_SYSTEM_CALL */
 {
     char * pcReturn;
@@ -634,6 +649,180 @@ BaseType_t MPU_xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
 #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_BUFFER_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    QueueHandle_t MPU_xQueueCreateBufferQueue( const UBaseType_t uxBufferCount,
+                                               const UBaseType_t uxBufferSize ) /* FREERTOS_SYSTEM_CALL */
+    {
+        QueueHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xQueueCreateBufferQueue( uxBufferCount, uxBufferSize );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( ( configUSE_BUFFER_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+    BaseType_t MPU_xQueueAcquireBuffer( QueueHandle_t xQueue,
+                                        void ** ppvBuffer,
+                                        TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xQueueAcquireBuffer( xQueue, ppvBuffer, xTicksToWait );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_BUFFER_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+    BaseType_t MPU_xQueueSendBuffer( QueueHandle_t xQueue,
+                                     void * pvBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xQueueSendBuffer( xQueue, pvBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_BUFFER_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+    BaseType_t MPU_xQueueReceiveBuffer( QueueHandle_t xQueue,
+                                        void ** ppvBuffer,
+                                        TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xQueueReceiveBuffer( xQueue, ppvBuffer, xTicksToWait );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_BUFFER_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+    BaseType_t MPU_xQueueReleaseBuffer( QueueHandle_t xQueue,
+                                        void * pvBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xQueueReleaseBuffer( xQueue, pvBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_BUFFER_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_POOLS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    PoolHandle_t MPU_xPoolCreateStatic( size_t xBlockSize,
+                                        UBaseType_t uxBlockCount,
+                                        uint8_t * pucPoolStorage,
+                                        StaticPool_t * pxPoolBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        PoolHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xPoolCreateStatic( xBlockSize, uxBlockCount, pucPoolStorage, pxPoolBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( ( configUSE_POOLS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POOLS == 1 )
+    BaseType_t MPU_xPoolAlloc( PoolHandle_t xPool,
+                               void ** ppvBlock,
+                               TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xPoolAlloc( xPool, ppvBlock, xTicksToWait );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_POOLS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POOLS == 1 )
+    BaseType_t MPU_xPoolFree( PoolHandle_t xPool,
+                              void * pvBlock ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xPoolFree( xPool, pvBlock );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_POOLS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_NOTIFY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    NotifyQueueHandle_t MPU_xNotifyQueueCreateStatic( UBaseType_t uxLength,
+                                                      uint32_t * pulStorage,
+                                                      StaticNotifyQueue_t * pxNotifyQueueBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        NotifyQueueHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xNotifyQueueCreateStatic( uxLength, pulStorage, pxNotifyQueueBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( ( configUSE_NOTIFY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+    BaseType_t MPU_xNotifyQueueSend( NotifyQueueHandle_t xNotifyQueue,
+                                     uint32_t ulEvent ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xNotifyQueueSend( xNotifyQueue, ulEvent );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_NOTIFY_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+    BaseType_t MPU_xNotifyQueueReceive( NotifyQueueHandle_t xNotifyQueue,
+                                        uint32_t * pulEvent,
+                                        TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+    {
+        BaseType_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xNotifyQueueReceive( xNotifyQueue, pulEvent, xTicksToWait );
+        vPortResetPrivilege( xRunningPrivileged );
+        return xReturn;
+    }
+#endif /* if ( configUSE_NOTIFY_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+    UBaseType_t MPU_uxNotifyQueueMessagesWaiting( NotifyQueueHandle_t xNotifyQueue ) /* FREERTOS_SYSTEM_CALL */
+    {
+        UBaseType_t uxReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        uxReturn = uxNotifyQueueMessagesWaiting( xNotifyQueue );
+        vPortResetPrivilege( xRunningPrivileged );
+        return uxReturn;
+    }
+#endif /* if ( configUSE_NOTIFY_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
 BaseType_t MPU_xQueueGenericReset( QueueHandle_t pxQueue,
                                    BaseType_t xNewQueue ) /* FREERTOS_SYSTEM_CALL */
 {
@@ -695,6 +884,34 @@ BaseType_t MPU_xQueueReceive( QueueHandle_t pxQueue,
 }
 /*-----------------------------------------------------------*/
 
+UBaseType_t MPU_uxQueueSendMultiple( QueueHandle_t xQueue,
+                                     const void * const pvItemsToQueue,
+                                     const UBaseType_t uxItemCount,
+                                     TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+{
+    BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+    UBaseType_t uxReturn;
+
+    uxReturn = uxQueueSendMultiple( xQueue, pvItemsToQueue, uxItemCount, xTicksToWait );
+    vPortResetPrivilege( xRunningPrivileged );
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t MPU_uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                        void * const pvBuffer,
+                                        const UBaseType_t uxMaxItems,
+                                        TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
+{
+    BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+    UBaseType_t uxReturn;
+
+    uxReturn = uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait );
+    vPortResetPrivilege( xRunningPrivileged );
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t MPU_xQueuePeek( QueueHandle_t xQueue,
                            void * const pvBuffer,
                            TickType_t xTicksToWait ) /* FREERTOS_SYSTEM_CALL */
@@ -985,6 +1202,82 @@ void MPU_vQueueDelete( QueueHandle_t xQueue ) /* FREERTOS_SYSTEM_CALL */
 #endif /* if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_FAST_TIMERS == 1 ) )
+    TimerHandle_t MPU_xTimerCreateFast( const char * const pcTimerName,
+                                        const TickType_t xTimerPeriodInTicks,
+                                        const UBaseType_t uxAutoReload,
+                                        void * const pvTimerID,
+                                        TimerCallbackFunction_t pxCallbackFunction ) /* FREERTOS_SYSTEM_CALL */
+    {
+        TimerHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xTimerCreateFast( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_FAST_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_FAST_TIMERS == 1 ) )
+    TimerHandle_t MPU_xTimerCreateFastStatic( const char * const pcTimerName,
+                                              const TickType_t xTimerPeriodInTicks,
+                                              const UBaseType_t uxAutoReload,
+                                              void * const pvTimerID,
+                                              TimerCallbackFunction_t pxCallbackFunction,
+                                              StaticTimer_t * pxTimerBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        TimerHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xTimerCreateFastStatic( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_FAST_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) )
+    TimerHandle_t MPU_xTimerCreateOnService( const char * const pcTimerName,
+                                             const TickType_t xTimerPeriodInTicks,
+                                             const UBaseType_t uxAutoReload,
+                                             void * const pvTimerID,
+                                             TimerCallbackFunction_t pxCallbackFunction,
+                                             const UBaseType_t uxService ) /* FREERTOS_SYSTEM_CALL */
+    {
+        TimerHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xTimerCreateOnService( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, uxService );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) )
+    TimerHandle_t MPU_xTimerCreateStaticOnService( const char * const pcTimerName,
+                                                   const TickType_t xTimerPeriodInTicks,
+                                                   const UBaseType_t uxAutoReload,
+                                                   void * const pvTimerID,
+                                                   TimerCallbackFunction_t pxCallbackFunction,
+                                                   StaticTimer_t * pxTimerBuffer,
+                                                   const UBaseType_t uxService ) /* FREERTOS_SYSTEM_CALL */
+    {
+        TimerHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xTimerCreateStaticOnService( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer, uxService );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TIMERS == 1 )
     void * MPU_pvTimerGetTimerID( const TimerHandle_t xTimer ) /* FREERTOS_SYSTEM_CALL */
     {
@@ -1039,6 +1332,20 @@ void MPU_vQueueDelete( QueueHandle_t xQueue ) /* FREERTOS_SYSTEM_CALL */
 #endif /* if ( configUSE_TIMERS == 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) )
+    TaskHandle_t MPU_xTimerGetServiceTaskHandle( const UBaseType_t uxService ) /* FREERTOS_SYSTEM_CALL */
+    {
+        TaskHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xTimerGetServiceTaskHandle( uxService );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* if ( ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
     BaseType_t MPU_xTimerPendFunctionCall( PendedFunction_t xFunctionToPend,
                                            void * pvParameter1,
@@ -1277,6 +1584,59 @@ size_t MPU_xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+size_t MPU_xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                                 void ** ppvData,
+                                 size_t xDataLengthBytes ) /* FREERTOS_SYSTEM_CALL */
+{
+    size_t xReturn;
+    BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+    xReturn = xStreamBufferReserve( xStreamBuffer, ppvData, xDataLengthBytes );
+    vPortResetPrivilege( xRunningPrivileged );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t MPU_xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes ) /* FREERTOS_SYSTEM_CALL */
+{
+    size_t xReturn;
+    BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+    xReturn = xStreamBufferCommit( xStreamBuffer, xDataLengthBytes );
+    vPortResetPrivilege( xRunningPrivileged );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t MPU_xStreamBufferPeekContiguous( StreamBufferHandle_t xStreamBuffer,
+                                        void ** ppvData ) /* FREERTOS_SYSTEM_CALL */
+{
+    size_t xReturn;
+    BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+    xReturn = xStreamBufferPeekContiguous( xStreamBuffer, ppvData );
+    vPortResetPrivilege( xRunningPrivileged );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t MPU_xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes ) /* FREERTOS_SYSTEM_CALL */
+{
+    size_t xReturn;
+    BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+    xReturn = xStreamBufferConsume( xStreamBuffer, xDataLengthBytes );
+    vPortResetPrivilege( xRunningPrivileged );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 void MPU_vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer ) /* FREERTOS_SYSTEM_CALL */
 {
     BaseType_t xRunningPrivileged = xPortRaisePrivilege();
@@ -1393,6 +1753,38 @@ BaseType_t MPU_xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+    StreamBufferHandle_t MPU_xStreamBufferGenericCreateChannel( size_t xBufferSizeBytes,
+                                                                size_t xTriggerLevelBytes,
+                                                                BaseType_t xIsMessageBuffer,
+                                                                uint8_t * const pucStreamBufferStorageArea,
+                                                                StaticStreamBuffer_t * const pxStaticStreamBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        StreamBufferHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xStreamBufferGenericCreateChannel( xBufferSizeBytes, xTriggerLevelBytes, xIsMessageBuffer, pucStreamBufferStorageArea, pxStaticStreamBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* configUSE_STREAM_BUFFER_CHANNELS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+    StreamBufferHandle_t MPU_xStreamBufferOpenChannel( StaticStreamBuffer_t * const pxStaticStreamBuffer ) /* FREERTOS_SYSTEM_CALL */
+    {
+        StreamBufferHandle_t xReturn;
+        BaseType_t xRunningPrivileged = xPortRaisePrivilege();
+
+        xReturn = xStreamBufferOpenChannel( pxStaticStreamBuffer );
+        vPortResetPrivilege( xRunningPrivileged );
+
+        return xReturn;
+    }
+#endif /* configUSE_STREAM_BUFFER_CHANNELS */
+/*-----------------------------------------------------------*/
+
 
 /* Functions that the application writer wants to execute in privileged mode
  * can be defined in application_defined_privileged_functions.h.  The functions
@@ -256,7 +256,9 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 
 	/* The task will start without a floating point context.  A task that uses
 	the floating point hardware must call vPortTaskUsesFPU() before executing
-	any floating point instructions. */
+	any floating point instructions, unless configUSE_LAZY_FPU_CONTEXT is 1, in
+	which case the task is given a floating point context when its first
+	floating point instruction traps. */
 	*pxTopOfStack = portNO_FLOATING_POINT_CONTEXT;
 
 	return pxTopOfStack;
@@ -437,12 +439,22 @@ void FreeRTOS_Tick_Handler( void )
 
 void vPortTaskUsesFPU( void )
 {
-	/* A task is registering the fact that it needs an FPU context.  Set the
-	FPU flag (which is saved as part of the task context). */
-	ullPortTaskHasFPUContext = pdTRUE;
+	#if( configUSE_LAZY_FPU_CONTEXT == 1 )
+	{
+		/* The task will be given an FPU context when it first uses the FPU.
+		Setting the FPU flag here, before floating point access is enabled,
+		would make the next context save trap. */
+	}
+	#else
+	{
+		/* A task is registering the fact that it needs an FPU context.  Set
+		the FPU flag (which is saved as part of the task context). */
+		ullPortTaskHasFPUContext = pdTRUE;
 
-	/* Consider initialising the FPSR here - but probably not necessary in
-	AArch64. */
+		/* Consider initialising the FPSR here - but probably not necessary in
+		AArch64. */
+	}
+	#endif /* configUSE_LAZY_FPU_CONTEXT */
 }
 /*-----------------------------------------------------------*/
 
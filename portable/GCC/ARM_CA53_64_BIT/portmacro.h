@@ -132,7 +132,24 @@ handler for whichever peripheral is used to generate the RTOS tick. */
 void FreeRTOS_Tick_Handler( void );
 
 /* Any task that uses the floating point unit MUST call vPortTaskUsesFPU()
-before any floating point instructions are executed. */
+before any floating point instructions are executed, unless
+configUSE_LAZY_FPU_CONTEXT is 1.
+
+If configUSE_LAZY_FPU_CONTEXT is 1 then floating point access is disabled while
+a task that does not have a floating point context runs.  The task's first
+floating point instruction traps to FreeRTOS_SWI_Handler, which gives the task a
+floating point context and re-executes the instruction, so only tasks that use
+the floating point unit save and restore its registers and no task needs to call
+vPortTaskUsesFPU().  As with GUEST, configUSE_LAZY_FPU_CONTEXT must be defined
+on the command line so it is seen by both port.c and portASM.S.  The
+synchronous exception vector must be installed to call FreeRTOS_SWI_Handler,
+and the kernel and interrupt handlers must not use the floating point or SIMD
+registers, for example by building them with GCC's -mgeneral-regs-only option,
+as they run with the floating point access of the interrupted task. */
+#ifndef configUSE_LAZY_FPU_CONTEXT
+	#define configUSE_LAZY_FPU_CONTEXT 0
+#endif
+
 void vPortTaskUsesFPU( void );
 #define portTASK_USES_FLOATING_POINT() vPortTaskUsesFPU()
 
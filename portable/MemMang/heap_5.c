@@ -88,6 +88,27 @@
 /* Assumes 8bit bytes! */
 #define heapBITS_PER_BYTE         ( ( size_t ) 8 )
 
+#if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+
+/* Blocks of up to configHEAP_SIZE_CLASS_MAX_SIZE bytes (including the
+ * BlockLink_t header) are rounded up to a multiple of heapSIZE_CLASS_STEP.  When
+ * such a block is freed it is pushed onto the list for its size instead of being
+ * merged back into the heap, so the next request of the same size class can be
+ * met without walking the list of free blocks. */
+    #if ( portBYTE_ALIGNMENT > 16 )
+        #define heapSIZE_CLASS_STEP    portBYTE_ALIGNMENT
+    #else
+        #define heapSIZE_CLASS_STEP    16
+    #endif
+
+    #if ( ( configHEAP_SIZE_CLASS_MAX_SIZE % heapSIZE_CLASS_STEP ) != 0 )
+        #error configHEAP_SIZE_CLASS_MAX_SIZE must be a multiple of 16 and of portBYTE_ALIGNMENT
+    #endif
+
+    #define heapSIZE_CLASS_COUNT          ( configHEAP_SIZE_CLASS_MAX_SIZE / heapSIZE_CLASS_STEP )
+    #define heapSIZE_CLASS_INDEX( xSize )    ( ( ( xSize ) / ( size_t ) heapSIZE_CLASS_STEP ) - ( size_t ) 1 )
+#endif /* configUSE_HEAP_SIZE_CLASSES */
+
 /* Define the linked list structure.  This is used to link free blocks in order
  * of their memory address. */
 typedef struct A_BLOCK_LINK
@@ -106,6 +127,30 @@ typedef struct A_BLOCK_LINK
  */
 static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert );
 
+#if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+
+/*
+ * Takes a block of exactly xWantedSize bytes from its size class list and marks
+ * it as allocated.  Returns NULL if the list is empty.
+ */
+    static void * prvSizeClassAllocate( size_t xWantedSize );
+
+/*
+ * Pushes a block that is being freed onto its size class list.  Returns pdFALSE
+ * if the block does not belong to a size class, in which case it must be
+ * inserted into the list of free blocks instead.
+ */
+    static BaseType_t prvSizeClassFree( BlockLink_t * pxBlockToFree );
+
+/*
+ * Moves every block held by the size class lists back into the list of free
+ * blocks so adjacent blocks can be merged again.  Returns pdTRUE if any block
+ * was moved.
+ */
+    static BaseType_t prvSizeClassFlush( void );
+
+#endif /* configUSE_HEAP_SIZE_CLASSES */
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -128,6 +173,14 @@ static size_t xNumberOfSuccessfulFrees = 0;
  * space. */
 static size_t xBlockAllocatedBit = 0;
 
+#if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+
+/* Entry n of the array heads a list of free blocks that are exactly
+ * ( n + 1 ) * heapSIZE_CLASS_STEP bytes, linked through pxNextFreeBlock.  The
+ * bytes held in these lists are still counted in xFreeBytesRemaining. */
+    static BlockLink_t * pxSizeClassFreeList[ heapSIZE_CLASS_COUNT ] = { NULL };
+#endif
+
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
@@ -178,7 +231,21 @@ void * pvPortMalloc( size_t xWantedSize )
                 xWantedSize = 0;
             }
 
-            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            #if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+                {
+                    if( ( xWantedSize > 0 ) && ( xWantedSize <= ( size_t ) configHEAP_SIZE_CLASS_MAX_SIZE ) )
+                    {
+                        xWantedSize = ( xWantedSize + ( ( size_t ) heapSIZE_CLASS_STEP - 1 ) ) & ~( ( size_t ) heapSIZE_CLASS_STEP - 1 );
+                        pvReturn = prvSizeClassAllocate( xWantedSize );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* configUSE_HEAP_SIZE_CLASSES */
+
+            if( ( pvReturn == NULL ) && ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
             {
                 /* Traverse the list from the start	(lowest address) block until
                  * one of adequate size is found. */
@@ -191,6 +258,29 @@ void * pvPortMalloc( size_t xWantedSize )
                     pxBlock = pxBlock->pxNextFreeBlock;
                 }
 
+                #if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+                    {
+                        /* Blocks held by the size class lists are never merged, so
+                         * before giving up return them to the list of free blocks
+                         * and search once more. */
+                        if( ( pxBlock == pxEnd ) && ( prvSizeClassFlush() != pdFALSE ) )
+                        {
+                            pxPreviousBlock = &xStart;
+                            pxBlock = xStart.pxNextFreeBlock;
+
+                            while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+                            {
+                                pxPreviousBlock = pxBlock;
+                                pxBlock = pxBlock->pxNextFreeBlock;
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_HEAP_SIZE_CLASSES */
+
                 /* If the end marker was reached then a block of adequate size
                  * was not found. */
                 if( pxBlock != pxEnd )
@@ -311,7 +401,24 @@ void vPortFree( void * pv )
                     /* Add this block to the list of free blocks. */
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE( pv, pxLink->xBlockSize );
-                    prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+
+                    #if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+                        {
+                            if( prvSizeClassFree( pxLink ) == pdFALSE )
+                            {
+                                prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #else
+                        {
+                            prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+                        }
+                    #endif /* configUSE_HEAP_SIZE_CLASSES */
+
                     xNumberOfSuccessfulFrees++;
                 }
                 ( void ) xTaskResumeAll();
@@ -499,6 +606,104 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+
+    static void * prvSizeClassAllocate( size_t xWantedSize )
+    {
+        BlockLink_t * pxBlock;
+        void * pvReturn = NULL;
+        const size_t xClass = heapSIZE_CLASS_INDEX( xWantedSize );
+
+        pxBlock = pxSizeClassFreeList[ xClass ];
+
+        if( pxBlock != NULL )
+        {
+            configASSERT( pxBlock->xBlockSize == xWantedSize );
+
+            pxSizeClassFreeList[ xClass ] = pxBlock->pxNextFreeBlock;
+            xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+            if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+            {
+                xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The block is being returned - it is allocated and owned by the
+             * application and has no "next" block. */
+            pxBlock->xBlockSize |= xBlockAllocatedBit;
+            pxBlock->pxNextFreeBlock = NULL;
+            xNumberOfSuccessfulAllocations++;
+
+            pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvReturn;
+    }
+
+#endif /* configUSE_HEAP_SIZE_CLASSES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+
+    static BaseType_t prvSizeClassFree( BlockLink_t * pxBlockToFree )
+    {
+        BaseType_t xReturn = pdFALSE;
+        size_t xClass;
+
+        /* Only blocks that were rounded to a size class are cached.  A block
+         * that was not split because the remainder was too small may not be. */
+        if( ( pxBlockToFree->xBlockSize <= ( size_t ) configHEAP_SIZE_CLASS_MAX_SIZE ) &&
+            ( ( pxBlockToFree->xBlockSize % ( size_t ) heapSIZE_CLASS_STEP ) == 0 ) )
+        {
+            xClass = heapSIZE_CLASS_INDEX( pxBlockToFree->xBlockSize );
+            pxBlockToFree->pxNextFreeBlock = pxSizeClassFreeList[ xClass ];
+            pxSizeClassFreeList[ xClass ] = pxBlockToFree;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_HEAP_SIZE_CLASSES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+
+    static BaseType_t prvSizeClassFlush( void )
+    {
+        BlockLink_t * pxBlock;
+        size_t xClass;
+        BaseType_t xReturn = pdFALSE;
+
+        for( xClass = 0; xClass < ( size_t ) heapSIZE_CLASS_COUNT; xClass++ )
+        {
+            while( pxSizeClassFreeList[ xClass ] != NULL )
+            {
+                pxBlock = pxSizeClassFreeList[ xClass ];
+                pxSizeClassFreeList[ xClass ] = pxBlock->pxNextFreeBlock;
+                prvInsertBlockIntoFreeList( pxBlock );
+                xReturn = pdTRUE;
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_HEAP_SIZE_CLASSES */
+/*-----------------------------------------------------------*/
+
 void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 {
     BlockLink_t * pxBlock;
@@ -506,6 +711,16 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 
     vTaskSuspendAll();
     {
+        #if ( configUSE_HEAP_SIZE_CLASSES == 1 )
+            {
+                /* Return the blocks held by the size class lists to the list of
+                 * free blocks first, as pvPortMalloc() would before failing, so
+                 * the largest free block reported is one that can be
+                 * allocated. */
+                ( void ) prvSizeClassFlush();
+            }
+        #endif /* configUSE_HEAP_SIZE_CLASSES */
+
         pxBlock = xStart.pxNextFreeBlock;
 
         /* pxBlock will be NULL if the heap has not been initialised.  The heap
@@ -0,0 +1,783 @@
+/*
+ * FreeRTOS Kernel V10.4.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses a two
+ * level segregated fit (TLSF) allocator, so both functions execute in a bounded
+ * time that does not depend on the number of free blocks.  Like heap_5.c the
+ * heap can be defined across multiple non-contiguous blocks of memory, and
+ * adjacent blocks are combined (coalesced) as they are freed.
+ *
+ * Free blocks are held on one of a fixed number of lists.  The first level
+ * splits block sizes into power of two ranges, and the second level splits each
+ * range linearly into heapSL_INDEX_COUNT lists.  A bitmap at each level records
+ * which lists are not empty, so a list that holds a large enough block is found
+ * with a couple of bit scans rather than by walking the free blocks.  The cost
+ * is that a request within a list's width (about 1/16) of the largest free block
+ * fails.  Setting configHEAP6_EXACT_FIT_FALLBACK to 1 in FreeRTOSConfig.h makes
+ * pvPortMalloc() walk the one list that can hold both larger and smaller blocks
+ * before failing, in which case its execution time is no longer bounded.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc(), exactly
+ * as when heap_5.c is used - see the comments at the top of heap_5.c.  Unlike
+ * heap_5.c the regions can be passed in any address order.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE    ( ( size_t ) 8 )
+
+/* Each first level range is split into 2 ^ heapSL_INDEX_COUNT_LOG2 lists. */
+#define heapSL_INDEX_COUNT_LOG2    4
+#define heapSL_INDEX_COUNT         ( 1 << heapSL_INDEX_COUNT_LOG2 )
+
+/* All block sizes are a multiple of portBYTE_ALIGNMENT. */
+#if ( portBYTE_ALIGNMENT == 32 )
+    #define heapALIGNMENT_LOG2    5
+#elif ( portBYTE_ALIGNMENT == 16 )
+    #define heapALIGNMENT_LOG2    4
+#elif ( portBYTE_ALIGNMENT == 8 )
+    #define heapALIGNMENT_LOG2    3
+#elif ( portBYTE_ALIGNMENT == 4 )
+    #define heapALIGNMENT_LOG2    2
+#elif ( portBYTE_ALIGNMENT == 2 )
+    #define heapALIGNMENT_LOG2    1
+#else
+    #define heapALIGNMENT_LOG2    0
+#endif
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE all go in first level list 0, which
+ * is split into heapSL_INDEX_COUNT lists that are each portBYTE_ALIGNMENT bytes
+ * apart.  Larger blocks go in the first level list that matches the position of
+ * the most significant bit of their size.  Blocks must be smaller than
+ * 2 ^ heapFL_INDEX_MAX bytes, which is limited so the first level bitmap fits in
+ * a uint32_t. */
+#define heapFL_INDEX_SHIFT      ( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#if defined( SIZE_MAX ) && ( SIZE_MAX <= 0xffffU )
+    #define heapFL_INDEX_MAX    15
+#else
+    #define heapFL_INDEX_MAX    30
+#endif
+#define heapFL_INDEX_COUNT      ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+#define heapSMALL_BLOCK_SIZE    ( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+#define heapMAX_BLOCK_SIZE      ( ( size_t ) 1 << heapFL_INDEX_MAX )
+
+/* Define the block header structure.  Every block, free or allocated, starts
+ * with the pxPreviousPhysicalBlock and xBlockSize members so it can be merged
+ * with its neighbours in memory when it is freed.  The free list links are only
+ * used while the block is free, so they overlap the memory returned to the
+ * application. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxPreviousPhysicalBlock; /*<< The block immediately below this one in memory, or NULL if this is the first block in its region. */
+    size_t xBlockSize;                             /*<< The size of the block, including the header. */
+    struct A_BLOCK_LINK * pxNextFreeBlock;         /*<< The next block in the same free list. */
+    struct A_BLOCK_LINK * pxPreviousFreeBlock;     /*<< The previous block in the same free list. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Calculates the first and second level list indexes for a block of xBlockSize
+ * bytes.
+ */
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel );
+
+/*
+ * Returns the block at the head of the first non-empty free list that only holds
+ * blocks of at least xWantedSize bytes, or NULL if there is no such list.  If
+ * configHEAP6_EXACT_FIT_FALLBACK is 1 and there is no such list, returns the
+ * first block of at least xWantedSize bytes in the list xWantedSize maps to
+ * instead.
+ */
+static BlockLink_t * prvFindSuitableBlock( size_t xWantedSize );
+
+/*
+ * Add a free block to, and remove a free block from, the free list that
+ * matches its size.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert );
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove );
+
+/*
+ * Returns the position of the most significant set bit in ulValue, or -1 if
+ * ulValue is zero.  The same number of steps is taken for every value.
+ */
+static BaseType_t prvFindLastSet( uint32_t ulValue );
+
+/*-----------------------------------------------------------*/
+
+/* The part of the block header that is present while the block is allocated
+ * must be correctly byte aligned. */
+static const size_t xHeapStructSize = ( ( sizeof( BlockLink_t * ) + sizeof( size_t ) ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* A free block must be large enough to hold the complete header. */
+static const size_t xMinimumBlockSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The heads of the free lists, and the bitmaps that record which of them are
+ * not empty.  Bit n of ulFirstLevelBitmap is set if any bit of
+ * ulSecondLevelBitmap[ n ] is set, and bit m of ulSecondLevelBitmap[ n ] is set
+ * if pxFreeLists[ n ][ m ] is not NULL. */
+static BlockLink_t * pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static uint32_t ulFirstLevelBitmap = 0U;
+static uint32_t ulSecondLevelBitmap[ heapFL_INDEX_COUNT ];
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0;
+static size_t xNumberOfSuccessfulFrees = 0;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+ * member of an BlockLink_t structure is set then the block belongs to the
+ * application.  When the bit is free the block is still part of the free heap
+ * space.  The marker placed at the end of each region always has the bit set so
+ * it is never merged with the block before it. */
+static size_t xBlockAllocatedBit = 0;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock, * pxNewBlockLink, * pxNextPhysicalBlock;
+    void * pvReturn = NULL;
+
+    /* The heap must be initialised before the first call to
+     * pvPortMalloc(). */
+    configASSERT( xBlockAllocatedBit );
+
+    vTaskSuspendAll();
+    {
+        /* Check the requested block size is not so large that the top bit is
+         * set.  The top bit of the block size member of the BlockLink_t structure
+         * is used to determine who owns the block - the application or the
+         * kernel, so it must be free. */
+        if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+        {
+            /* The wanted size is increased so it can contain the allocated part
+             * of a BlockLink_t structure in addition to the requested amount of
+             * bytes. */
+            if( ( xWantedSize > 0 ) &&
+                ( ( xWantedSize + xHeapStructSize ) > xWantedSize ) ) /* Overflow check */
+            {
+                xWantedSize += xHeapStructSize;
+
+                /* Ensure that blocks are always aligned */
+                if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+                {
+                    /* Byte alignment required. Check for overflow */
+                    if( ( xWantedSize + ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) ) ) >
+                        xWantedSize )
+                    {
+                        xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+                    }
+                    else
+                    {
+                        xWantedSize = 0;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The block must be able to hold the free list links once it
+                 * is freed again. */
+                if( ( xWantedSize > 0 ) && ( xWantedSize < xMinimumBlockSize ) )
+                {
+                    xWantedSize = xMinimumBlockSize;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                xWantedSize = 0;
+            }
+
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) && ( xWantedSize < heapMAX_BLOCK_SIZE ) )
+            {
+                /* Find a list in which every block is large enough, and take the
+                 * block at its head. */
+                pxBlock = prvFindSuitableBlock( xWantedSize );
+
+                if( pxBlock != NULL )
+                {
+                    /* This block is being returned for use so must be taken out
+                     * of the list of free blocks. */
+                    prvRemoveBlockFromFreeList( pxBlock );
+
+                    /* Return the memory space pointed to - jumping over the
+                     * allocated part of the BlockLink_t structure at its start. */
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+
+                    /* If the block is larger than required it can be split into
+                     * two. */
+                    if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+                    {
+                        /* This block is to be split into two.  Create a new
+                         * block following the number of bytes requested. The void
+                         * cast is used to prevent byte alignment warnings from the
+                         * compiler. */
+                        pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                        configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                        /* Calculate the sizes of two blocks split from the
+                         * single block, and keep the physical links intact. */
+                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                        pxNewBlockLink->pxPreviousPhysicalBlock = pxBlock;
+                        pxBlock->xBlockSize = xWantedSize;
+
+                        pxNextPhysicalBlock = ( void * ) ( ( ( uint8_t * ) pxNewBlockLink ) + pxNewBlockLink->xBlockSize );
+                        pxNextPhysicalBlock->pxPreviousPhysicalBlock = pxNewBlockLink;
+
+                        /* Insert the new block into the list of free blocks. */
+                        prvInsertBlockIntoFreeList( pxNewBlockLink );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* The block is being returned - it is allocated and owned
+                     * by the application. */
+                    pxBlock->xBlockSize |= xBlockAllocatedBit;
+                    xNumberOfSuccessfulAllocations++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+        {
+            if( pvReturn == NULL )
+            {
+                extern void vApplicationMallocFailedHook( void );
+                vApplicationMallocFailedHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink, * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have the allocated part of a BlockLink_t
+         * structure immediately before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        /* Check the block is actually allocated. */
+        configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+
+        if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+        {
+            vTaskSuspendAll();
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated.  Unlike heap_4.c and heap_5.c the allocated bit is
+                 * read when a physically adjacent block is freed, so it must
+                 * only be cleared with the scheduler suspended. */
+                pxLink->xBlockSize &= ~xBlockAllocatedBit;
+                xFreeBytesRemaining += pxLink->xBlockSize;
+                traceFREE( pv, pxLink->xBlockSize );
+
+                /* Merge with the block below this one in memory if it is
+                 * free. */
+                pxNeighbour = pxLink->pxPreviousPhysicalBlock;
+
+                if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 ) )
+                {
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxLink->xBlockSize;
+                    pxLink = pxNeighbour;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Merge with the block above this one in memory if it is free.
+                 * The marker at the end of each region is always marked as
+                 * allocated, so this never runs off the end of a region. */
+                pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize );
+
+                if( ( pxNeighbour->xBlockSize & xBlockAllocatedBit ) == 0 )
+                {
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxLink->xBlockSize += pxNeighbour->xBlockSize;
+                    pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxNeighbour->pxPreviousPhysicalBlock = pxLink;
+
+                /* Add the (possibly merged) block to the list of free
+                 * blocks. */
+                prvInsertBlockIntoFreeList( pxLink );
+                xNumberOfSuccessfulFrees++;
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvFindLastSet( uint32_t ulValue )
+{
+    BaseType_t xBit = 0;
+
+    if( ulValue == 0U )
+    {
+        xBit = -1;
+    }
+    else
+    {
+        if( ( ulValue & 0xffff0000UL ) != 0U )
+        {
+            ulValue >>= 16;
+            xBit += 16;
+        }
+
+        if( ( ulValue & 0xff00UL ) != 0U )
+        {
+            ulValue >>= 8;
+            xBit += 8;
+        }
+
+        if( ( ulValue & 0xf0UL ) != 0U )
+        {
+            ulValue >>= 4;
+            xBit += 4;
+        }
+
+        if( ( ulValue & 0xcUL ) != 0U )
+        {
+            ulValue >>= 2;
+            xBit += 2;
+        }
+
+        if( ( ulValue & 0x2UL ) != 0U )
+        {
+            xBit += 1;
+        }
+    }
+
+    return xBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel )
+{
+    BaseType_t xMostSignificantBit;
+
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
+    {
+        /* Small blocks are held in lists portBYTE_ALIGNMENT bytes apart. */
+        *puxFirstLevel = 0;
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+    }
+    else
+    {
+        /* The most significant bit selects the first level list, and the
+         * heapSL_INDEX_COUNT_LOG2 bits below it select the second level
+         * list. */
+        xMostSignificantBit = prvFindLastSet( ( uint32_t ) xBlockSize );
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> ( xMostSignificantBit - heapSL_INDEX_COUNT_LOG2 ) ) ^ ( UBaseType_t ) heapSL_INDEX_COUNT;
+        *puxFirstLevel = ( UBaseType_t ) ( xMostSignificantBit - ( heapFL_INDEX_SHIFT - 1 ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvFindSuitableBlock( size_t xWantedSize )
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+    uint32_t ulMap;
+    BlockLink_t * pxBlock = NULL;
+    size_t xRoundedSize = xWantedSize;
+
+    /* Round the size up to the start of the next list so every block in the
+     * list that is found is large enough - this is what makes the search
+     * constant time. */
+    if( xRoundedSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xRoundedSize += ( ( size_t ) 1 << ( prvFindLastSet( ( uint32_t ) xRoundedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - ( size_t ) 1;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xRoundedSize < heapMAX_BLOCK_SIZE )
+    {
+        prvMappingInsert( xRoundedSize, &uxFirstLevel, &uxSecondLevel );
+
+        /* Look for a non-empty list at or above the second level index within
+         * the same first level range. */
+        ulMap = ulSecondLevelBitmap[ uxFirstLevel ] & ( ~( uint32_t ) 0U << uxSecondLevel );
+
+        if( ulMap == 0U )
+        {
+            /* There is none, so use the smallest non-empty list in any larger
+             * first level range. */
+            ulMap = ulFirstLevelBitmap & ( ~( uint32_t ) 0U << ( uxFirstLevel + 1U ) );
+
+            if( ulMap != 0U )
+            {
+                uxFirstLevel = ( UBaseType_t ) prvFindLastSet( ulMap & ( ~ulMap + 1U ) );
+                ulMap = ulSecondLevelBitmap[ uxFirstLevel ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ulMap != 0U )
+        {
+            uxSecondLevel = ( UBaseType_t ) prvFindLastSet( ulMap & ( ~ulMap + 1U ) );
+            pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( configHEAP6_EXACT_FIT_FALLBACK == 1 )
+        {
+            if( pxBlock == NULL )
+            {
+                /* Every list above the one xWantedSize maps to is empty, but
+                 * that list can still hold a block that is large enough, so walk
+                 * it rather than fail. */
+                prvMappingInsert( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+                pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+
+                while( ( pxBlock != NULL ) && ( pxBlock->xBlockSize < xWantedSize ) )
+                {
+                    pxBlock = pxBlock->pxNextFreeBlock;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configHEAP6_EXACT_FIT_FALLBACK */
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert )
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    prvMappingInsert( pxBlockToInsert->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+    /* Add the block to the head of its list. */
+    pxBlockToInsert->pxPreviousFreeBlock = NULL;
+    pxBlockToInsert->pxNextFreeBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+
+    if( pxBlockToInsert->pxNextFreeBlock != NULL )
+    {
+        pxBlockToInsert->pxNextFreeBlock->pxPreviousFreeBlock = pxBlockToInsert;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlockToInsert;
+
+    ulFirstLevelBitmap |= ( uint32_t ) 1U << uxFirstLevel;
+    ulSecondLevelBitmap[ uxFirstLevel ] |= ( uint32_t ) 1U << uxSecondLevel;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove )
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    prvMappingInsert( pxBlockToRemove->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+    if( pxBlockToRemove->pxNextFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxNextFreeBlock->pxPreviousFreeBlock = pxBlockToRemove->pxPreviousFreeBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxBlockToRemove->pxPreviousFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxPreviousFreeBlock->pxNextFreeBlock = pxBlockToRemove->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was at the head of its list.  If the list is now empty
+         * clear its bit, and the first level bit if that was the last
+         * non-empty list in the range. */
+        pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlockToRemove->pxNextFreeBlock;
+
+        if( pxBlockToRemove->pxNextFreeBlock == NULL )
+        {
+            ulSecondLevelBitmap[ uxFirstLevel ] &= ~( ( uint32_t ) 1U << uxSecondLevel );
+
+            if( ulSecondLevelBitmap[ uxFirstLevel ] == 0U )
+            {
+                ulFirstLevelBitmap &= ~( ( uint32_t ) 1U << uxFirstLevel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+    BlockLink_t * pxFirstFreeBlockInRegion, * pxEndMarker;
+    size_t xAlignedHeap;
+    size_t xTotalRegionSize, xTotalHeapSize = 0;
+    BaseType_t xDefinedRegions = 0;
+    size_t xAddress;
+    const HeapRegion_t * pxHeapRegion;
+
+    /* Can only call once! */
+    configASSERT( xBlockAllocatedBit == 0 );
+
+    /* Work out the position of the top bit in a size_t variable. */
+    xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+    pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+    while( pxHeapRegion->xSizeInBytes > 0 )
+    {
+        xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+        /* Ensure the heap region starts on a correctly aligned boundary. */
+        xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+
+        if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+        {
+            xAddress += ( portBYTE_ALIGNMENT - 1 );
+            xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+            /* Adjust the size for the bytes lost to alignment. */
+            xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+        }
+
+        xAlignedHeap = xAddress;
+
+        /* The end marker is placed at the end of the region space.  It only
+         * needs room for the allocated part of a BlockLink_t structure, and
+         * is marked as allocated so it is never merged with a free block. */
+        xAddress = xAlignedHeap + xTotalRegionSize;
+        xAddress -= xHeapStructSize;
+        xAddress &= ~portBYTE_ALIGNMENT_MASK;
+        pxEndMarker = ( BlockLink_t * ) xAddress;
+        pxEndMarker->xBlockSize = xBlockAllocatedBit;
+
+        /* To start with there is a single free block in this region that is
+         * sized to take up the entire heap region minus the space taken by the
+         * end marker. */
+        pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAlignedHeap;
+        pxFirstFreeBlockInRegion->xBlockSize = xAddress - ( size_t ) pxFirstFreeBlockInRegion;
+        pxFirstFreeBlockInRegion->pxPreviousPhysicalBlock = NULL;
+        pxEndMarker->pxPreviousPhysicalBlock = pxFirstFreeBlockInRegion;
+
+        /* The first level bitmap limits the size of a single block. */
+        configASSERT( pxFirstFreeBlockInRegion->xBlockSize >= xMinimumBlockSize );
+        configASSERT( pxFirstFreeBlockInRegion->xBlockSize < heapMAX_BLOCK_SIZE );
+
+        prvInsertBlockIntoFreeList( pxFirstFreeBlockInRegion );
+
+        xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+
+        /* Move onto the next HeapRegion_t structure. */
+        xDefinedRegions++;
+        pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+    }
+
+    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+    xFreeBytesRemaining = xTotalHeapSize;
+
+    /* Check something was actually defined before it is accessed. */
+    configASSERT( xTotalHeapSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+    vTaskSuspendAll();
+    {
+        /* Unlike the other operations on this heap, walking every free block
+         * takes a time proportional to the number of free blocks. */
+        for( uxFirstLevel = 0; uxFirstLevel < ( UBaseType_t ) heapFL_INDEX_COUNT; uxFirstLevel++ )
+        {
+            for( uxSecondLevel = 0; uxSecondLevel < ( UBaseType_t ) heapSL_INDEX_COUNT; uxSecondLevel++ )
+            {
+                for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                {
+                    /* Increment the number of blocks and record the largest
+                     * and smallest blocks seen so far. */
+                    xBlocks++;
+
+                    if( pxBlock->xBlockSize > xMaxSize )
+                    {
+                        xMaxSize = pxBlock->xBlockSize;
+                    }
+
+                    if( pxBlock->xBlockSize < xMinSize )
+                    {
+                        xMinSize = pxBlock->xBlockSize;
+                    }
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
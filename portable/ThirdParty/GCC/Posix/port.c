@@ -46,6 +46,19 @@
  * stdio (printf() and friends) should be called from a single task
  * only or serialized with a FreeRTOS primitive such as a binary
  * semaphore or mutex.
+ *
+ * When configNUMBER_OF_CORES is greater than 1 one thread runs for
+ * each simulated core.  Each core performs its own task switches,
+ * another core is asked to switch by sending its thread SIG_YIELD,
+ * and the kernel's task and ISR locks are recursive spinlocks owned
+ * by a core.  A task switch on a core hands the locks held by the
+ * core over to the thread being resumed on it.
+ *
+ * Ticks are counted against CLOCK_MONOTONIC, so a SIGALRM that the
+ * host delays does not lose ticks.  When configUSE_VIRTUAL_TIME is 1
+ * the clock is virtual: whenever every task is blocked the idle task
+ * moves it straight to the tick on which the next task unblocks, so a
+ * mostly idle application runs much faster than real time.
  *----------------------------------------------------------*/
 
 #include <errno.h>
@@ -67,6 +80,16 @@
 
 #define SIG_RESUME SIGUSR1
 
+#if ( configNUMBER_OF_CORES > 1 )
+    #include <sched.h>
+
+    #define SIG_YIELD SIGUSR2
+#endif
+
+#if ( ( configUSE_VIRTUAL_TIME == 1 ) && ( configUSE_TICKLESS_IDLE != 1 ) )
+    #error configUSE_VIRTUAL_TIME requires configUSE_TICKLESS_IDLE to be set to 1
+#endif
+
 typedef struct THREAD
 {
     pthread_t pthread;
@@ -74,6 +97,9 @@ typedef struct THREAD
     void *pvParams;
     BaseType_t xDying;
     struct event *ev;
+#if ( configNUMBER_OF_CORES > 1 )
+    volatile BaseType_t xCoreID;    /* The core the thread is running on, set by the core that resumes it. */
+#endif
 } Thread_t;
 
 /*
@@ -94,7 +120,29 @@ static sigset_t xResumeSignals;
 static sigset_t xAllSignals;
 static sigset_t xSchedulerOriginalSignalMask;
 static pthread_t hMainThread = ( pthread_t )NULL;
+#if ( configNUMBER_OF_CORES == 1 )
 static volatile portBASE_TYPE uxCriticalNesting;
+#else
+/*
+ * Recursive ticket lock.  Tickets are served in order so a core
+ * cannot starve the others by releasing and taking the lock again
+ * while their threads wait for the host to schedule them.
+ */
+typedef struct CORE_LOCK
+{
+    volatile UBaseType_t uxNextTicket;
+    volatile UBaseType_t uxNowServing;
+    volatile BaseType_t xOwner;     /* ID of the core holding the lock, or -1. */
+    volatile UBaseType_t uxCount;   /* Number of times the owner has taken the lock. */
+} CoreLock_t;
+
+static CoreLock_t xTaskLock = { 0, 0, -1, 0 };
+static CoreLock_t xISRLock = { 0, 0, -1, 0 };
+static __thread Thread_t *pxThisThread = NULL;
+static volatile portBASE_TYPE uxCriticalNestings[ configNUMBER_OF_CORES ];
+static portBASE_TYPE xCriticalEnteredMasked[ configNUMBER_OF_CORES ];
+static volatile BaseType_t xYieldDeferred[ configNUMBER_OF_CORES ];
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 static portBASE_TYPE xSchedulerEnd = pdFALSE;
@@ -103,12 +151,21 @@ static portBASE_TYPE xSchedulerEnd = pdFALSE;
 static void prvSetupSignalsAndSchedulerPolicy( void );
 static void prvSetupTimerInterrupt( void );
 static void *prvWaitForStart( void * pvParams );
+#if ( configNUMBER_OF_CORES == 1 )
 static void prvSwitchThread( Thread_t * xThreadToResume,
                              Thread_t *xThreadToSuspend );
+#endif
 static void prvSuspendSelf( Thread_t * thread);
 static void prvResumeThread( Thread_t * xThreadId );
 static void vPortSystemTickHandler( int sig );
 static void vPortStartFirstTask( void );
+static void prvSetTickTimer( uint64_t ullFirstTickNs );
+static void prvStartTickTimer( void );
+static BaseType_t prvCountDueTicks( void );
+#if ( configNUMBER_OF_CORES > 1 )
+static void prvSwitchContextOnThisCore( void );
+static void prvYieldSignalHandler( int sig );
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvFatalError( const char *pcCall, int iErrno )
@@ -141,6 +198,9 @@ int iRet;
     thread->pxCode = pxCode;
     thread->pvParams = pvParameters;
     thread->xDying = pdFALSE;
+#if ( configNUMBER_OF_CORES > 1 )
+    thread->xCoreID = -1;
+#endif
 
     pthread_attr_init( &xThreadAttributes );
     pthread_attr_setstack( &xThreadAttributes, pxEndOfStack, ulStackSize );
@@ -164,10 +224,23 @@ int iRet;
 
 void vPortStartFirstTask( void )
 {
+#if ( configNUMBER_OF_CORES == 1 )
 Thread_t *pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
     /* Start the first task. */
     prvResumeThread( pxFirstThread );
+#else
+Thread_t *pxFirstThread;
+BaseType_t xCoreID;
+
+    /* Start the first task on each core. */
+    for ( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+    {
+        pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+        pxFirstThread->xCoreID = xCoreID;
+        prvResumeThread( pxFirstThread );
+    }
+#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -200,6 +273,18 @@ sigset_t xSignals;
     /* Cancel the Idle task and free its resources */
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
     vPortCancelThread( xTaskGetIdleTaskHandle() );
+
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+    BaseType_t xCoreID;
+
+        /* The other cores' idle tasks too. */
+        for ( xCoreID = 1; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+        {
+            vPortCancelThread( xTaskGetIdleTaskHandleForCore( xCoreID ) );
+        }
+    }
+    #endif
 #endif
 
 #if ( configUSE_TIMERS == 1 )
@@ -216,18 +301,12 @@ sigset_t xSignals;
 
 void vPortEndScheduler( void )
 {
-struct itimerval itimer;
 struct sigaction sigtick;
 Thread_t *xCurrentThread;
 
     /* Stop the timer and ignore any pending SIGALRMs that would end
      * up running on the main thread when it is resumed. */
-    itimer.it_value.tv_sec = 0;
-    itimer.it_value.tv_usec = 0;
-
-    itimer.it_interval.tv_sec = 0;
-    itimer.it_interval.tv_usec = 0;
-    (void)setitimer( ITIMER_REAL, &itimer, NULL );
+    prvSetTickTimer( 0 );
 
     sigtick.sa_flags = 0;
     sigtick.sa_handler = SIG_IGN;
@@ -236,6 +315,23 @@ Thread_t *xCurrentThread;
 
     /* Signal the scheduler to exit its loop. */
     xSchedulerEnd = pdTRUE;
+
+#if ( configNUMBER_OF_CORES > 1 )
+    {
+    BaseType_t xCoreID;
+
+        /* Stop the other cores.  They suspend themselves when they see
+         * xSchedulerEnd on their next context switch. */
+        for ( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+        {
+            if ( xCoreID != xPortGetCoreID() )
+            {
+                vPortYieldCore( xCoreID );
+            }
+        }
+    }
+#endif
+
     (void)pthread_kill( hMainThread, SIG_RESUME );
 
     xCurrentThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
@@ -243,6 +339,7 @@ Thread_t *xCurrentThread;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES == 1 )
 void vPortEnterCritical( void )
 {
     if ( uxCriticalNesting == 0 )
@@ -315,60 +412,359 @@ void vPortClearInterruptMask( portBASE_TYPE xMask )
 }
 /*-----------------------------------------------------------*/
 
+#else /* configNUMBER_OF_CORES */
+
+BaseType_t xPortGetCoreID( void )
+{
+    /* The thread calling xTaskStartScheduler() acts as core 0 until the
+     * scheduler is started. */
+    if ( pxThisThread == NULL )
+    {
+        return 0;
+    }
+
+    return pxThisThread->xCoreID;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetLock( CoreLock_t *pxLock )
+{
+BaseType_t xCoreID = xPortGetCoreID();
+UBaseType_t uxTicket;
+
+    /* Must be called with all signals blocked so the calling thread
+     * cannot be switched to a different core while holding the lock. */
+    if ( pxLock->xOwner != xCoreID )
+    {
+        uxTicket = __atomic_fetch_add( &pxLock->uxNextTicket, 1, __ATOMIC_RELAXED );
+
+        while ( __atomic_load_n( &pxLock->uxNowServing, __ATOMIC_ACQUIRE ) != uxTicket )
+        {
+            sched_yield();
+        }
+
+        pxLock->xOwner = xCoreID;
+    }
+
+    pxLock->uxCount++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReleaseLock( CoreLock_t *pxLock )
+{
+    configASSERT( pxLock->xOwner == xPortGetCoreID() );
+
+    pxLock->uxCount--;
+
+    if ( pxLock->uxCount == 0 )
+    {
+        pxLock->xOwner = -1;
+        __atomic_store_n( &pxLock->uxNowServing, pxLock->uxNowServing + 1, __ATOMIC_RELEASE );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetTaskLock( void )
+{
+    prvGetLock( &xTaskLock );
+}
+/*-----------------------------------------------------------*/
+
+void vPortReleaseTaskLock( void )
+{
+    prvReleaseLock( &xTaskLock );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetISRLock( void )
+{
+    prvGetLock( &xISRLock );
+}
+/*-----------------------------------------------------------*/
+
+void vPortReleaseISRLock( void )
+{
+    prvReleaseLock( &xISRLock );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+portBASE_TYPE xWasMasked = xPortMaskInterrupts();
+BaseType_t xCoreID = xPortGetCoreID();
+
+    if ( uxCriticalNestings[ xCoreID ] == 0 )
+    {
+        vPortGetTaskLock();
+        vPortGetISRLock();
+
+        /* Signals are already blocked if called from a signal
+         * handler and must stay blocked when the critical section
+         * is exited. */
+        xCriticalEnteredMasked[ xCoreID ] = xWasMasked;
+    }
+    uxCriticalNestings[ xCoreID ]++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+BaseType_t xCoreID = xPortGetCoreID();
+portBASE_TYPE xWasMasked;
+
+    uxCriticalNestings[ xCoreID ]--;
+
+    /* If we have reached 0 then release the locks, perform any yield
+     * requested from within the critical section, and re-enable the
+     * interrupts. */
+    if ( uxCriticalNestings[ xCoreID ] == 0 )
+    {
+        xWasMasked = xCriticalEnteredMasked[ xCoreID ];
+
+        vPortReleaseISRLock();
+        vPortReleaseTaskLock();
+
+        if ( xYieldDeferred[ xCoreID ] != pdFALSE )
+        {
+            prvSwitchContextOnThisCore();
+        }
+
+        vPortRestoreInterrupts( xWasMasked );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+portBASE_TYPE xWasMasked = xPortMaskInterrupts();
+
+    prvSwitchContextOnThisCore();
+
+    vPortRestoreInterrupts( xWasMasked );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldCore( BaseType_t xCoreID )
+{
+Thread_t *pxThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+
+    (void)pthread_kill( pxThread->pthread, SIG_YIELD );
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+    pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+    pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortMaskInterrupts( void )
+{
+sigset_t xPreviousSignals;
+
+    pthread_sigmask( SIG_BLOCK, &xAllSignals, &xPreviousSignals );
+
+    /* SIGALRM stands in for all the signals as they are always
+     * blocked together. */
+    return sigismember( &xPreviousSignals, SIGALRM ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortRestoreInterrupts( portBASE_TYPE xMask )
+{
+    if ( xMask == pdFALSE )
+    {
+        vPortEnableInterrupts();
+    }
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortSetInterruptMask( void )
+{
+portBASE_TYPE xWasMasked = xPortMaskInterrupts();
+
+    /* Interrupts on the other cores are kept out by the ISR lock. */
+    vPortGetISRLock();
+
+    return xWasMasked;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( portBASE_TYPE xMask )
+{
+    vPortReleaseISRLock();
+    vPortRestoreInterrupts( xMask );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configNUMBER_OF_CORES */
+
+#if ( configUSE_VIRTUAL_TIME == 1 )
+/* The time skipped by the idle task, which puts the port's clock ahead of
+ * CLOCK_MONOTONIC. */
+static uint64_t prvSkippedNs;
+#endif
+
 static uint64_t prvGetTimeNs(void)
 {
 struct timespec t;
 
     clock_gettime(CLOCK_MONOTONIC, &t);
 
+#if ( configUSE_VIRTUAL_TIME == 1 )
+    return t.tv_sec * 1000000000ull + t.tv_nsec + prvSkippedNs;
+#else
     return t.tv_sec * 1000000000ull + t.tv_nsec;
+#endif
 }
 
+/*
+ * The tick timeline.  Tick n is due prvTickTimeNs( n ) after
+ * prvStartTimeNs, and prvTickCount is the number of ticks counted since
+ * then.  Ticks are counted from the timeline rather than from the
+ * SIGALRMs, which the host can delay or merge.
+ */
 static uint64_t prvStartTimeNs;
-/* commented as part of the code below in vPortSystemTickHandler,
- * to adjust timing according to full demo requirements */
-/* static uint64_t prvTickCount; */
+static uint64_t prvTickCount;
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+/* The longest time the tick is suppressed for, an hour, keeps the timer
+ * arithmetic well clear of overflow. */
+#define portMAX_SUPPRESSED_TICKS	( ( TickType_t ) configTICK_RATE_HZ * 60 * 60 )
+
+/* Set while the idle thread sleeps so the SIGALRM that ends the sleep
+ * leaves counting the ticks to vPortSuppressTicksAndSleep(). */
+static volatile BaseType_t xTickSuppressed = pdFALSE;
+#endif
 
 /*
- * Setup the systick timer to generate the tick interrupts at the required
- * frequency.
+ * Returns the time, relative to prvStartTimeNs, at which tick ullTick is
+ * due, rounded up to a whole nanosecond.  The tick number is split into
+ * whole seconds so the arithmetic cannot overflow.
  */
-void prvSetupTimerInterrupt( void )
+static uint64_t prvTickTimeNs( uint64_t ullTick )
+{
+uint64_t ullSeconds = ullTick / configTICK_RATE_HZ;
+uint64_t ullTicks = ullTick % configTICK_RATE_HZ;
+
+    return ullSeconds * 1000000000ull +
+           ( ullTicks * 1000000000ull + configTICK_RATE_HZ - 1 ) / configTICK_RATE_HZ;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the number of ticks that are due by ullTimeNs after
+ * prvStartTimeNs.
+ */
+static uint64_t prvTicksDueAt( uint64_t ullTimeNs )
+{
+uint64_t ullSeconds = ullTimeNs / 1000000000ull;
+uint64_t ullNs = ullTimeNs % 1000000000ull;
+
+    return ullSeconds * configTICK_RATE_HZ +
+           ( ullNs * configTICK_RATE_HZ ) / 1000000000ull;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Arm ITIMER_REAL to raise SIGALRM ullFirstTickNs from now, rounded up
+ * to a whole microsecond, and then once every tick period.  The period is
+ * rounded up too, so a SIGALRM never arrives before a tick is due.  The
+ * timer is stopped if ullFirstTickNs is 0.
+ */
+static void prvSetTickTimer( uint64_t ullFirstTickNs )
 {
 struct itimerval itimer;
+uint64_t ullFirstTickUs = ( ullFirstTickNs + 999 ) / 1000;
+uint64_t ullTickPeriodUs = ( 1000000 + configTICK_RATE_HZ - 1 ) / configTICK_RATE_HZ;
 int iRet;
 
-    /* Initialise the structure with the current timer information. */
-    iRet = getitimer( ITIMER_REAL, &itimer );
+    itimer.it_value.tv_sec = ullFirstTickUs / 1000000;
+    itimer.it_value.tv_usec = ullFirstTickUs % 1000000;
+
+    itimer.it_interval.tv_sec = ullTickPeriodUs / 1000000;
+    itimer.it_interval.tv_usec = ullTickPeriodUs % 1000000;
+
+    iRet = setitimer( ITIMER_REAL, &itimer, NULL );
     if ( iRet )
     {
-        prvFatalError( "getitimer", errno );
+        prvFatalError( "setitimer", errno );
     }
+}
+/*-----------------------------------------------------------*/
 
-    /* Set the interval between timer events. */
-    itimer.it_interval.tv_sec = 0;
-    itimer.it_interval.tv_usec = portTICK_RATE_MICROSECONDS;
+/*
+ * Start the tick timer so the next SIGALRM arrives when the tick after
+ * the last one counted is due, or at once if it is already due.
+ */
+static void prvStartTickTimer( void )
+{
+uint64_t ullNowNs = prvGetTimeNs() - prvStartTimeNs;
+uint64_t ullNextTickNs = prvTickTimeNs( prvTickCount + 1 );
 
-    /* Set the current count-down. */
-    itimer.it_value.tv_sec = 0;
-    itimer.it_value.tv_usec = portTICK_RATE_MICROSECONDS;
+    prvSetTickTimer( ( ullNextTickNs > ullNowNs ) ? ( ullNextTickNs - ullNowNs ) : 1 );
+}
+/*-----------------------------------------------------------*/
 
-    /* Set-up the timer interrupt. */
-    iRet = setitimer( ITIMER_REAL, &itimer, NULL );
-    if ( iRet )
+/*
+ * Count every tick that is due, replaying the ticks of any SIGALRMs the
+ * host lost or delayed so the tick count does not drift from
+ * CLOCK_MONOTONIC.  Must be called with the tick blocked.  Returns pdTRUE
+ * if a context switch is required.
+ */
+static BaseType_t prvCountDueTicks( void )
+{
+uint64_t ullTicksDue = prvTicksDueAt( prvGetTimeNs() - prvStartTimeNs );
+BaseType_t xSwitchRequired = pdFALSE;
+
+    while ( prvTickCount < ullTicksDue )
     {
-        prvFatalError( "setitimer", errno );
+        if ( xTaskIncrementTick() != pdFALSE )
+        {
+            xSwitchRequired = pdTRUE;
+        }
+        prvTickCount++;
     }
 
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the systick timer to generate the tick interrupts at the required
+ * frequency.  Tick rates above 1000 Hz are supported, up to the
+ * microsecond resolution of ITIMER_REAL.
+ */
+void prvSetupTimerInterrupt( void )
+{
+    configASSERT( configTICK_RATE_HZ <= 1000000 );
+
     prvStartTimeNs = prvGetTimeNs();
+    prvTickCount = 0;
+
+    prvStartTickTimer();
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES == 1 )
 static void vPortSystemTickHandler( int sig )
 {
 Thread_t *pxThreadToSuspend;
 Thread_t *pxThreadToResume;
-/* uint64_t xExpectedTicks; */
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+    if ( xTickSuppressed != pdFALSE )
+    {
+        /* The tick ended a sleep, see vPortSuppressTicksAndSleep(). */
+        return;
+    }
+#endif
 
     uxCriticalNesting++; /* Signals are blocked in this signal handler. */
 
@@ -378,15 +774,7 @@ Thread_t *pxThreadToResume;
 
     /* Tick Increment, accounting for any lost signals or drift in
      * the timer. */
-/*
- *      Comment code to adjust timing according to full demo requirements
- *      xExpectedTicks = (prvGetTimeNs() - prvStartTimeNs)
- *        / (portTICK_RATE_MICROSECONDS * 1000);
- * do { */
-        xTaskIncrementTick();
-/*        prvTickCount++;
- *    } while (prvTickCount < xExpectedTicks);
-*/
+    (void)prvCountDueTicks();
 
 #if ( configUSE_PREEMPTION == 1 )
     /* Select Next Task. */
@@ -401,6 +789,191 @@ Thread_t *pxThreadToResume;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TICKLESS_IDLE == 1 )
+/*
+ * Called by the idle task, with the scheduler suspended, in place of
+ * letting the tick run while every task is blocked.  The tick timer is
+ * set to expire only on the tick at which the next task is due to
+ * unblock, and the idle thread waits in sigsuspend() so no host CPU is
+ * used until that tick, or another signal, arrives.  With virtual time
+ * the time until that tick is skipped instead.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+sigset_t xSignals;
+eSleepModeStatus eSleepStatus;
+uint64_t ullNowNs;
+uint64_t ullWakeNs;
+uint64_t ullTicksDue;
+TickType_t xCompleteTicks;
+TickType_t xModifiableIdleTime;
+
+    if ( xExpectedIdleTime > portMAX_SUPPRESSED_TICKS )
+    {
+        xExpectedIdleTime = portMAX_SUPPRESSED_TICKS;
+    }
+
+    /* Block the tick and stop the tick timer. */
+    vPortDisableInterrupts();
+    prvSetTickTimer( 0 );
+
+    /* Don't sleep if a task was made ready, or a tick became pending,
+     * since the idle task decided to sleep. */
+    (void)sigpending( &xSignals );
+    eSleepStatus = eTaskConfirmSleepModeStatus();
+
+    if ( ( eSleepStatus != eAbortSleep ) && ( sigismember( &xSignals, SIGALRM ) == 0 ) )
+    {
+        xModifiableIdleTime = xExpectedIdleTime;
+
+        if ( eSleepStatus == eStandardSleep )
+        {
+            ullNowNs = prvGetTimeNs() - prvStartTimeNs;
+            ullWakeNs = prvTickTimeNs( prvTickCount + xExpectedIdleTime );
+
+#if ( configUSE_VIRTUAL_TIME == 1 )
+            /* Nothing can happen before the next task unblocks, so skip
+             * to the tick on which it does rather than sleep until then. */
+            if ( ullWakeNs > ullNowNs )
+            {
+                prvSkippedNs += ullWakeNs - ullNowNs;
+            }
+            xModifiableIdleTime = 0;
+#else
+            /* Wake on the tick at which the next task is due to unblock. */
+            prvSetTickTimer( ( ullWakeNs > ullNowNs ) ? ( ullWakeNs - ullNowNs ) : 1 );
+#endif
+        }
+        else
+        {
+            /* No task is waiting for a timeout, so the timer is left
+             * stopped and only a signal from outside the kernel can end
+             * the sleep. */
+        }
+
+        /* Sleep with all signals unblocked, as they are while a task
+         * runs, until a signal handler has run.  configPRE_SLEEP_PROCESSING()
+         * can set xModifiableIdleTime to 0 to skip the sleep. */
+        xTickSuppressed = pdTRUE;
+        configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+        if ( xModifiableIdleTime > 0 )
+        {
+            sigemptyset( &xSignals );
+            (void)sigsuspend( &xSignals );
+        }
+        configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+        xTickSuppressed = pdFALSE;
+
+        prvSetTickTimer( 0 );
+
+        /* Step over the ticks that were due during the sleep, except the
+         * tick on which the next task unblocks, which must be counted by
+         * the tick handler like any ticks due after it. */
+        ullTicksDue = prvTicksDueAt( prvGetTimeNs() - prvStartTimeNs ) - prvTickCount;
+        xCompleteTicks = ( ullTicksDue < xExpectedIdleTime ) ? ( TickType_t ) ullTicksDue : ( xExpectedIdleTime - 1 );
+
+        vTaskStepTick( xCompleteTicks );
+        prvTickCount += xCompleteTicks;
+    }
+
+    /* Count the ticks that are already due, including the tick on which
+     * the next task unblocks if the sleep lasted that long.  The scheduler
+     * is suspended so they are held pending until the idle task resumes
+     * it, and a task they unblock runs before anything else can happen. */
+    (void)prvCountDueTicks();
+
+    prvStartTickTimer();
+
+    vPortEnableInterrupts();
+}
+/*-----------------------------------------------------------*/
+#endif /* configUSE_TICKLESS_IDLE */
+
+#else /* configNUMBER_OF_CORES */
+
+static void vPortSystemTickHandler( int sig )
+{
+portBASE_TYPE xSavedInterruptStatus;
+BaseType_t xSwitchRequired;
+
+    /* The tick is processed on whichever core's thread receives it. */
+    xSavedInterruptStatus = xPortSetInterruptMask();
+    xSwitchRequired = prvCountDueTicks();
+    vPortClearInterruptMask( xSavedInterruptStatus );
+
+#if ( configUSE_PREEMPTION == 1 )
+    if ( xSwitchRequired != pdFALSE )
+    {
+        prvSwitchContextOnThisCore();
+    }
+#else
+    ( void ) xSwitchRequired;
+#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldSignalHandler( int sig )
+{
+    /* Another core has asked this core to select a new task. */
+    prvSwitchContextOnThisCore();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContextOnThisCore( void )
+{
+Thread_t *pxThreadToSuspend = pxThisThread;
+Thread_t *pxThreadToResume;
+BaseType_t xCoreID = pxThreadToSuspend->xCoreID;
+
+    /* Must be called with all signals blocked. */
+
+    if ( xSchedulerEnd != pdFALSE )
+    {
+        /* vPortEndScheduler() has been called on another core. */
+        for ( ;; )
+        {
+            prvSuspendSelf( pxThreadToSuspend );
+        }
+    }
+
+    if ( ( xTaskLock.xOwner == xCoreID ) || ( xISRLock.xOwner == xCoreID ) )
+    {
+        /* Like a yield requested with interrupts disabled, the switch
+         * happens when the critical section is exited. */
+        xYieldDeferred[ xCoreID ] = pdTRUE;
+        return;
+    }
+
+    xYieldDeferred[ xCoreID ] = pdFALSE;
+
+    vPortGetTaskLock();
+    vPortGetISRLock();
+
+    vTaskSwitchContext( xCoreID );
+
+    pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+
+    if ( pxThreadToSuspend != pxThreadToResume )
+    {
+        /* The resumed thread releases the locks held by this core. */
+        pxThreadToResume->xCoreID = xCoreID;
+        prvResumeThread( pxThreadToResume );
+        if ( pxThreadToSuspend->xDying )
+        {
+            pthread_exit( NULL );
+        }
+        prvSuspendSelf( pxThreadToSuspend );
+
+        /* Resumed, possibly on a different core, by a core that is
+         * holding its locks. */
+    }
+
+    vPortReleaseISRLock();
+    vPortReleaseTaskLock();
+}
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
 void vPortThreadDying( void *pxTaskToDelete, volatile BaseType_t *pxPendYield )
 {
 Thread_t *pxThread = prvGetThreadFromTask( pxTaskToDelete );
@@ -427,8 +1000,26 @@ Thread_t *pxThread = pvParams;
 
     prvSuspendSelf(pxThread);
 
+#if ( configNUMBER_OF_CORES == 1 )
     /* Resumed for the first time, unblocks all signals. */
     uxCriticalNesting = 0;
+#else
+    pxThisThread = pxThread;
+
+    /* Release the locks held by the core that resumed this thread,
+     * unless the scheduler is being started in which case none are
+     * held. */
+    if ( xISRLock.xOwner == pxThread->xCoreID )
+    {
+        vPortReleaseISRLock();
+    }
+    if ( xTaskLock.xOwner == pxThread->xCoreID )
+    {
+        vPortReleaseTaskLock();
+    }
+
+    /* Resumed for the first time, unblocks all signals. */
+#endif
     vPortEnableInterrupts();
 
     /* Call the task's entry point. */
@@ -445,6 +1036,7 @@ Thread_t *pxThread = pvParams;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES == 1 )
 static void prvSwitchThread( Thread_t *pxThreadToResume,
                              Thread_t *pxThreadToSuspend )
 {
@@ -471,6 +1063,7 @@ BaseType_t uxSavedCriticalNesting;
         uxCriticalNesting = uxSavedCriticalNesting;
     }
 }
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvSuspendSelf( Thread_t *thread )
@@ -525,7 +1118,7 @@ int iRet;
      * will be unblocked.
      */
     (void)pthread_sigmask( SIG_SETMASK, &xAllSignals,
-                           *&xSchedulerOriginalSignalMask );
+                           &xSchedulerOriginalSignalMask );
 
     /* SIG_RESUME is only used with sigwait() so doesn't need a
        handler. */
@@ -548,6 +1141,22 @@ int iRet;
     {
         prvFatalError( "sigaction", errno );
     }
+
+#if ( configNUMBER_OF_CORES > 1 )
+    {
+    struct sigaction sigyield;
+
+        sigyield.sa_flags = 0;
+        sigyield.sa_handler = prvYieldSignalHandler;
+        sigfillset( &sigyield.sa_mask );
+
+        iRet = sigaction( SIG_YIELD, &sigyield, NULL );
+        if ( iRet )
+        {
+            prvFatalError( "sigaction", errno );
+        }
+    }
+#endif
 }
 /*-----------------------------------------------------------*/
 
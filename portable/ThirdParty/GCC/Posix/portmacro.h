@@ -86,8 +86,16 @@ extern void vPortYield( void );
 /* Critical section management. */
 extern void vPortDisableInterrupts( void );
 extern void vPortEnableInterrupts( void );
+#if ( configNUMBER_OF_CORES == 1 )
 #define portSET_INTERRUPT_MASK()        ( vPortDisableInterrupts() )
 #define portCLEAR_INTERRUPT_MASK()      ( vPortEnableInterrupts() )
+#else
+/* Masks return whether signals were already blocked so they can nest. */
+extern portBASE_TYPE xPortMaskInterrupts( void );
+extern void vPortRestoreInterrupts( portBASE_TYPE xMask );
+#define portSET_INTERRUPT_MASK()        xPortMaskInterrupts()
+#define portCLEAR_INTERRUPT_MASK( x )   vPortRestoreInterrupts( x )
+#endif
 
 extern portBASE_TYPE xPortSetInterruptMask( void );
 extern void vPortClearInterruptMask( portBASE_TYPE xMask );
@@ -96,13 +104,41 @@ extern void vPortEnterCritical( void );
 extern void vPortExitCritical( void );
 #define portSET_INTERRUPT_MASK_FROM_ISR()		xPortSetInterruptMask()
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask(x)
-#define portDISABLE_INTERRUPTS()				portSET_INTERRUPT_MASK()
-#define portENABLE_INTERRUPTS()					portCLEAR_INTERRUPT_MASK()
+#define portDISABLE_INTERRUPTS()				vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()					vPortEnableInterrupts()
 #define portENTER_CRITICAL()					vPortEnterCritical()
 #define portEXIT_CRITICAL()						vPortExitCritical()
 
 /*-----------------------------------------------------------*/
 
+/* Tickless idle support, see port.c. */
+#ifndef configUSE_VIRTUAL_TIME
+#define configUSE_VIRTUAL_TIME	0
+#endif
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )	vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+/* Symmetric multiprocessing.  Each core is a thread, see port.c. */
+extern BaseType_t xPortGetCoreID( void );
+extern void vPortYieldCore( BaseType_t xCoreID );
+extern void vPortGetTaskLock( void );
+extern void vPortReleaseTaskLock( void );
+extern void vPortGetISRLock( void );
+extern void vPortReleaseISRLock( void );
+#define portGET_CORE_ID()				xPortGetCoreID()
+#define portYIELD_CORE( xCoreID )		vPortYieldCore( xCoreID )
+#define portGET_TASK_LOCK()				vPortGetTaskLock()
+#define portRELEASE_TASK_LOCK()			vPortReleaseTaskLock()
+#define portGET_ISR_LOCK()				vPortGetISRLock()
+#define portRELEASE_ISR_LOCK()			vPortReleaseISRLock()
+#endif
+/*-----------------------------------------------------------*/
+
 extern void vPortThreadDying( void *pxTaskToDelete, volatile BaseType_t *pxPendYield );
 extern void vPortCancelThread( void *pxTaskToDelete );
 #define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxPendYield ) vPortThreadDying( ( pvTaskToDelete ), ( pxPendYield ) )
@@ -119,9 +155,13 @@ extern void vPortCancelThread( void *pxTaskToDelete );
  * which also imply a full memory barrier.
  *
  * Thus, only a compilier barrier is needed to prevent the compiler
- * reordering.
+ * reordering, unless several tasks run at once on an SMP build.
  */
+#if ( configNUMBER_OF_CORES > 1 )
+#define portMEMORY_BARRIER() __sync_synchronize()
+#else
 #define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
+#endif
 
 extern unsigned long ulPortGetRunTime( void );
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() /* no-op */
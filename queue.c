@@ -40,6 +40,15 @@
     #include "croutine.h"
 #endif
 
+#if ( configUSE_POOLS == 1 )
+    #include "pool.h"
+#endif
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+    #include "atomic.h"
+    #include "notify_queue.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -128,12 +137,54 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_BUFFER_QUEUES == 1 )
+        struct QueueDefinition * pxBufferPool; /*< The queue of free buffers if the structure is used as a buffer queue, otherwise NULL. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+#if ( configUSE_POOLS == 1 )
+
+/* A memory pool is a counting semaphore that holds one count per free block,
+ * and a singly linked list of the free blocks that is threaded through the
+ * blocks themselves.  Taking the semaphore reserves a block, so the list is
+ * never empty when a block is popped from it.  xFreeBlockCount must remain the
+ * first member so a PoolHandle_t can be passed to the queue API. */
+    typedef struct PoolDefinition
+    {
+        Queue_t xFreeBlockCount;
+        void * pvFreeList;        /*< The first free block.  The first word of each free block points to the next. */
+        uint8_t * pucPoolStorage; /*< The start of the blocks, used to check blocks being freed. */
+        size_t xBlockSize;
+    } Pool_t;
+
+#endif /* configUSE_POOLS */
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+/* A notify queue is a ring of slots, each of which holds a sequence number and
+ * an event.  Positions count up without limit, wrapping at 2^32, and position
+ * ulPosition uses slot ( ulPosition & ulMask ).  A slot whose sequence number
+ * equals ulPosition is free to be written for that position, and one whose
+ * sequence number equals ( ulPosition + 1 ) holds the event for that position.
+ * Posters claim a position by advancing ulHead with a compare and swap, so no
+ * two posters write the same slot, and the receiving task frees a slot for the
+ * position one lap ahead once it has read the event. */
+    typedef struct NotifyQueueDefinition
+    {
+        volatile uint32_t ulHead;                     /*< The next position to be claimed by a poster. */
+        uint32_t ulTail;                              /*< The next position to be received.  Only moved by the receiving task. */
+        uint32_t ulMask;                              /*< One less than the number of slots, which is a power of two. */
+        volatile uint32_t * pulSlots;                 /*< Two words per slot, the sequence number followed by the event. */
+        volatile TaskHandle_t xTaskWaitingToReceive;  /*< The receiving task while it is blocked, otherwise NULL. */
+    } NotifyQueue_t;
+
+#endif /* configUSE_NOTIFY_QUEUES */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -201,6 +252,26 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies uxItemCount items to the back of a queue, or out of the front of a
+ * queue, using at most two calls to memcpy().  There must be room for, or
+ * there must be, uxItemCount items in the queue.
+ */
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                    const void * pvItemsToQueue,
+                                    const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                      void * const pvBuffer,
+                                      const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes up to uxMaxTasks tasks from pxEventList, one for each item sent to
+ * or received from a queue.  Returns pdTRUE if any removed task has a priority
+ * above the calling task.  Must be called from a critical section.
+ */
+static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList,
+                                          UBaseType_t uxMaxTasks ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -441,261 +512,967 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
-                                   const UBaseType_t uxItemSize,
-                                   uint8_t * pucQueueStorage,
-                                   const uint8_t ucQueueType,
-                                   Queue_t * pxNewQueue )
-{
-    /* Remove compiler warnings about unused parameters should
-     * configUSE_TRACE_FACILITY not be set to 1. */
-    ( void ) ucQueueType;
+#if ( ( configUSE_BUFFER_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-    if( uxItemSize == ( UBaseType_t ) 0 )
-    {
-        /* No RAM was allocated for the queue storage area, but PC head cannot
-         * be set to NULL because NULL is used as a key to say the queue is used as
-         * a mutex.  Therefore just set pcHead to point to the queue as a benign
-         * value that is known to be within the memory map. */
-        pxNewQueue->pcHead = ( int8_t * ) pxNewQueue;
-    }
-    else
+    QueueHandle_t xQueueCreateBufferQueue( const UBaseType_t uxBufferCount,
+                                           const UBaseType_t uxBufferSize )
     {
-        /* Set the head to the start of the queue storage area. */
-        pxNewQueue->pcHead = ( int8_t * ) pucQueueStorage;
-    }
+        Queue_t * pxNewQueue;
+        Queue_t * pxBufferPool;
+        size_t xBlockSize, xPointersSize, xBlocksOffset, xTotalSize;
+        uint8_t * pucPointerStorage;
+        uint8_t * pucBlock;
+        UBaseType_t uxBuffer;
+        BaseType_t xResult;
 
-    /* Initialise the queue members as described where the queue type is
-     * defined. */
-    pxNewQueue->uxLength = uxQueueLength;
-    pxNewQueue->uxItemSize = uxItemSize;
-    ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
+        configASSERT( uxBufferCount > ( UBaseType_t ) 0 );
+        configASSERT( uxBufferSize > ( UBaseType_t ) 0 );
 
-    #if ( configUSE_TRACE_FACILITY == 1 )
+        /* Round each buffer up so every buffer meets the alignment that
+         * pvPortMalloc() guarantees. */
+        xBlockSize = ( size_t ) uxBufferSize;
+
+        if( ( xBlockSize & portBYTE_ALIGNMENT_MASK ) != ( size_t ) 0 )
         {
-            pxNewQueue->ucQueueType = ucQueueType;
+            xBlockSize += ( size_t ) portBYTE_ALIGNMENT - ( xBlockSize & portBYTE_ALIGNMENT_MASK );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif /* configUSE_TRACE_FACILITY */
 
-    #if ( configUSE_QUEUE_SETS == 1 )
+        /* The queue, the pool of free buffers, the storage for the buffer
+         * pointers held by each, and the buffers themselves are allocated as
+         * a single block so they are freed together by vQueueDelete(). */
+        xPointersSize = ( size_t ) uxBufferCount * sizeof( void * ) * ( size_t ) 2;
+        xBlocksOffset = ( sizeof( Queue_t ) * ( size_t ) 2 ) + xPointersSize;
+
+        if( ( xBlocksOffset & portBYTE_ALIGNMENT_MASK ) != ( size_t ) 0 )
         {
-            pxNewQueue->pxQueueSetContainer = NULL;
+            xBlocksOffset += ( size_t ) portBYTE_ALIGNMENT - ( xBlocksOffset & portBYTE_ALIGNMENT_MASK );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-    #endif /* configUSE_QUEUE_SETS */
 
-    traceQUEUE_CREATE( pxNewQueue );
-}
-/*-----------------------------------------------------------*/
+        xTotalSize = xBlocksOffset + ( ( size_t ) uxBufferCount * xBlockSize );
 
-#if ( configUSE_MUTEXES == 1 )
+        /* Check for multiplication and addition overflow. */
+        configASSERT( ( xTotalSize - xBlocksOffset ) / xBlockSize == ( size_t ) uxBufferCount );
+        configASSERT( xTotalSize > xBlocksOffset );
+
+        pxNewQueue = ( Queue_t * ) pvPortMalloc( xTotalSize ); /*lint !e9087 !e9079 see comment in xQueueGenericCreate(). */
 
-    static void prvInitialiseMutex( Queue_t * pxNewQueue )
-    {
         if( pxNewQueue != NULL )
         {
-            /* The queue create function will set all the queue structure members
-            * correctly for a generic queue, but this function is creating a
-            * mutex.  Overwrite those members that need to be set differently -
-            * in particular the information required for priority inheritance. */
-            pxNewQueue->u.xSemaphore.xMutexHolder = NULL;
-            pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
+            pxBufferPool = &( pxNewQueue[ 1 ] );
+            pucPointerStorage = ( uint8_t * ) &( pxNewQueue[ 2 ] );
 
-            /* In case this is a recursive mutex. */
-            pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* The pool lives inside the queue's allocation so must never
+                     * be freed on its own. */
+                    pxNewQueue->ucStaticallyAllocated = pdFALSE;
+                    pxBufferPool->ucStaticallyAllocated = pdTRUE;
+                }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
 
-            traceCREATE_MUTEX( pxNewQueue );
+            prvInitialiseNewQueue( uxBufferCount, ( UBaseType_t ) sizeof( void * ), pucPointerStorage, queueQUEUE_TYPE_BUFFER_QUEUE, pxNewQueue );
+            prvInitialiseNewQueue( uxBufferCount, ( UBaseType_t ) sizeof( void * ), pucPointerStorage + ( xPointersSize / ( size_t ) 2 ), queueQUEUE_TYPE_BUFFER_QUEUE, pxBufferPool );
+            pxNewQueue->pxBufferPool = pxBufferPool;
 
-            /* Start with the semaphore in the expected state. */
-            ( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+            /* Start with every buffer in the pool. */
+            pucBlock = ( ( uint8_t * ) pxNewQueue ) + xBlocksOffset;
+
+            for( uxBuffer = ( UBaseType_t ) 0; uxBuffer < uxBufferCount; uxBuffer++ )
+            {
+                xResult = xQueueGenericSend( pxBufferPool, &pucBlock, ( TickType_t ) 0, queueSEND_TO_BACK );
+                configASSERT( xResult == pdPASS );
+                ( void ) xResult;
+                pucBlock += xBlockSize;
+            }
         }
         else
         {
-            traceCREATE_MUTEX_FAILED();
+            traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_BUFFER_QUEUE );
+            mtCOVERAGE_TEST_MARKER();
         }
+
+        return pxNewQueue;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( ( configUSE_BUFFER_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#if ( ( configUSE_POOLS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-    QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
+    PoolHandle_t xPoolCreateStatic( size_t xBlockSize,
+                                    UBaseType_t uxBlockCount,
+                                    uint8_t * pucPoolStorage,
+                                    StaticPool_t * pxPoolBuffer )
     {
-        QueueHandle_t xNewQueue;
-        const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+        Pool_t * pxNewPool = NULL;
+        uint8_t * pucBlock;
+        UBaseType_t uxBlock;
 
-        xNewQueue = xQueueGenericCreate( uxMutexLength, uxMutexSize, ucQueueType );
-        prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+        configASSERT( uxBlockCount > ( UBaseType_t ) 0 );
+        configASSERT( pucPoolStorage );
+        configASSERT( pxPoolBuffer );
 
-        return xNewQueue;
-    }
+        /* Every block must be able to hold the free list link. */
+        configASSERT( xBlockSize >= sizeof( void * ) );
+        configASSERT( ( xBlockSize % sizeof( void * ) ) == ( size_t ) 0 );
+        configASSERT( ( ( ( size_t ) pucPoolStorage ) % sizeof( void * ) ) == ( size_t ) 0 );
 
-#endif /* configUSE_MUTEXES */
-/*-----------------------------------------------------------*/
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticPool_t equals the size of the real pool
+                 * structure. */
+                volatile size_t xSize = sizeof( StaticPool_t );
+                configASSERT( xSize == sizeof( Pool_t ) );
+                ( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+            }
+        #endif /* configASSERT_DEFINED */
 
-#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        if( ( pucPoolStorage != NULL ) && ( pxPoolBuffer != NULL ) )
+        {
+            /* The address of a statically allocated pool was passed in, use it.
+             * The address of a statically allocated storage area was also passed
+             * in. */
+            pxNewPool = ( Pool_t * ) pxPoolBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
 
-    QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType,
-                                           StaticQueue_t * pxStaticQueue )
-    {
-        QueueHandle_t xNewQueue;
-        const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Pools can only be allocated statically, so note this in
+                     * case the pool is later deleted. */
+                    pxNewPool->xFreeBlockCount.ucStaticallyAllocated = pdTRUE;
+                }
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
-        /* Prevent compiler warnings about unused parameters if
-         * configUSE_TRACE_FACILITY does not equal 1. */
-        ( void ) ucQueueType;
+            prvInitialiseNewQueue( uxBlockCount, ( UBaseType_t ) 0, NULL, queueQUEUE_TYPE_POOL, &( pxNewPool->xFreeBlockCount ) );
+            pxNewPool->pucPoolStorage = pucPoolStorage;
+            pxNewPool->xBlockSize = xBlockSize;
 
-        xNewQueue = xQueueGenericCreateStatic( uxMutexLength, uxMutexSize, NULL, pxStaticQueue, ucQueueType );
-        prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+            /* Thread every block onto the free list, lowest address first, and
+             * start with one count per block. */
+            pxNewPool->pvFreeList = NULL;
+            pucBlock = pucPoolStorage + ( ( size_t ) uxBlockCount * xBlockSize );
 
-        return xNewQueue;
+            for( uxBlock = ( UBaseType_t ) 0; uxBlock < uxBlockCount; uxBlock++ )
+            {
+                pucBlock -= xBlockSize;
+                *( ( void ** ) pucBlock ) = pxNewPool->pvFreeList; /*lint !e9087 !e826 The block is at least pointer sized and aligned, as checked above. */
+                pxNewPool->pvFreeList = ( void * ) pucBlock;
+            }
+
+            pxNewPool->xFreeBlockCount.uxMessagesWaiting = uxBlockCount;
+        }
+        else
+        {
+            traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_POOL );
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( PoolHandle_t ) pxNewPool;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( ( configUSE_POOLS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
+#if ( configUSE_POOLS == 1 )
 
-    TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore )
+    BaseType_t xPoolAlloc( PoolHandle_t xPool,
+                           void ** ppvBlock,
+                           TickType_t xTicksToWait )
     {
-        TaskHandle_t pxReturn;
-        Queue_t * const pxSemaphore = ( Queue_t * ) xSemaphore;
+        Pool_t * const pxPool = xPool;
+        BaseType_t xReturn;
 
-        /* This function is called by xSemaphoreGetMutexHolder(), and should not
-         * be called directly.  Note:  This is a good way of determining if the
-         * calling task is the mutex holder, but not a good way of determining the
-         * identity of the mutex holder, as the holder may change between the
-         * following critical section exiting and the function returning. */
-        taskENTER_CRITICAL();
+        configASSERT( pxPool );
+        configASSERT( ppvBlock );
+
+        /* Reserve a block by taking a count, blocking in the same way as a
+         * semaphore take if no block is free. */
+        xReturn = xQueueSemaphoreTake( ( QueueHandle_t ) &( pxPool->xFreeBlockCount ), xTicksToWait );
+
+        if( xReturn == pdPASS )
         {
-            if( pxSemaphore->uxQueueType == queueQUEUE_IS_MUTEX )
-            {
-                pxReturn = pxSemaphore->u.xSemaphore.xMutexHolder;
-            }
-            else
+            taskENTER_CRITICAL();
             {
-                pxReturn = NULL;
+                configASSERT( pxPool->pvFreeList );
+                *ppvBlock = pxPool->pvFreeList;
+                pxPool->pvFreeList = *( ( void ** ) pxPool->pvFreeList );
             }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            *ppvBlock = NULL;
+            xReturn = pdFAIL;
         }
-        taskEXIT_CRITICAL();
 
-        return pxReturn;
-    } /*lint !e818 xSemaphore cannot be a pointer to const because it is a typedef. */
+        return xReturn;
+    }
 
-#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) ) */
+#endif /* configUSE_POOLS */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
+#if ( configUSE_POOLS == 1 )
 
-    TaskHandle_t xQueueGetMutexHolderFromISR( QueueHandle_t xSemaphore )
+    BaseType_t xPoolAllocFromISR( PoolHandle_t xPool,
+                                  void ** ppvBlock,
+                                  BaseType_t * const pxHigherPriorityTaskWoken )
     {
-        TaskHandle_t pxReturn;
+        Pool_t * const pxPool = xPool;
+        BaseType_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
 
-        configASSERT( xSemaphore );
+        configASSERT( pxPool );
+        configASSERT( ppvBlock );
 
-        /* Mutexes cannot be used in interrupt service routines, so the mutex
-         * holder should not change in an ISR, and therefore a critical section is
-         * not required here. */
-        if( ( ( Queue_t * ) xSemaphore )->uxQueueType == queueQUEUE_IS_MUTEX )
+        xReturn = xQueueReceiveFromISR( ( QueueHandle_t ) &( pxPool->xFreeBlockCount ), NULL, pxHigherPriorityTaskWoken );
+
+        if( xReturn == pdPASS )
         {
-            pxReturn = ( ( Queue_t * ) xSemaphore )->u.xSemaphore.xMutexHolder;
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                configASSERT( pxPool->pvFreeList );
+                *ppvBlock = pxPool->pvFreeList;
+                pxPool->pvFreeList = *( ( void ** ) pxPool->pvFreeList );
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
         }
         else
         {
-            pxReturn = NULL;
+            *ppvBlock = NULL;
+            xReturn = pdFAIL;
         }
 
-        return pxReturn;
-    } /*lint !e818 xSemaphore cannot be a pointer to const because it is a typedef. */
+        return xReturn;
+    }
 
-#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) ) */
+#endif /* configUSE_POOLS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+#if ( configUSE_POOLS == 1 )
 
-    BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex )
+    static void prvAssertBlockInPool( const Pool_t * const pxPool,
+                                      const void * const pvBlock )
     {
-        BaseType_t xReturn;
-        Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+        const uint8_t * const pucBlock = ( const uint8_t * ) pvBlock;
+        size_t xOffset;
+
+        /* The block must be the start of one of the pool's own blocks. */
+        configASSERT( pucBlock >= pxPool->pucPoolStorage );
+        xOffset = ( size_t ) ( pucBlock - pxPool->pucPoolStorage );
+        configASSERT( ( xOffset % pxPool->xBlockSize ) == ( size_t ) 0 );
+        configASSERT( ( xOffset / pxPool->xBlockSize ) < ( size_t ) pxPool->xFreeBlockCount.uxLength );
+        ( void ) xOffset;
+    }
 
-        configASSERT( pxMutex );
+#endif /* configUSE_POOLS */
+/*-----------------------------------------------------------*/
 
-        /* If this is the task that holds the mutex then xMutexHolder will not
-         * change outside of this task.  If this task does not hold the mutex then
-         * pxMutexHolder can never coincidentally equal the tasks handle, and as
-         * this is the only condition we are interested in it does not matter if
-         * pxMutexHolder is accessed simultaneously by another task.  Therefore no
-         * mutual exclusion is required to test the pxMutexHolder variable. */
-        if( pxMutex->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() )
-        {
-            traceGIVE_MUTEX_RECURSIVE( pxMutex );
+#if ( configUSE_POOLS == 1 )
 
-            /* uxRecursiveCallCount cannot be zero if xMutexHolder is equal to
-             * the task handle, therefore no underflow check is required.  Also,
-             * uxRecursiveCallCount is only modified by the mutex holder, and as
-             * there can only be one, no mutual exclusion is required to modify the
-             * uxRecursiveCallCount member. */
-            ( pxMutex->u.xSemaphore.uxRecursiveCallCount )--;
+    static BaseType_t prvPushFreeBlock( Pool_t * const pxPool,
+                                        void * const pvBlock )
+    {
+        BaseType_t xReturn = pdPASS;
 
-            /* Has the recursive call count unwound to 0? */
-            if( pxMutex->u.xSemaphore.uxRecursiveCallCount == ( UBaseType_t ) 0 )
-            {
-                /* Return the mutex.  This will automatically unblock any other
-                 * task that might be waiting to access the mutex. */
-                ( void ) xQueueGenericSend( pxMutex, NULL, queueMUTEX_GIVE_BLOCK_TIME, queueSEND_TO_BACK );
-            }
-            else
+        /* Must be called with interrupts masked. */
+        #if ( configPOOL_CHECK_DOUBLE_FREE == 1 )
             {
-                mtCOVERAGE_TEST_MARKER();
+                const void * pvFreeBlock;
+
+                /* A block that is already on the free list has been freed
+                 * twice.  Linking it again would make the list a cycle and give
+                 * back a count that does not belong to a block, so the free is
+                 * rejected instead. */
+                for( pvFreeBlock = pxPool->pvFreeList; pvFreeBlock != NULL; pvFreeBlock = *( ( void * const * ) pvFreeBlock ) )
+                {
+                    if( pvFreeBlock == pvBlock )
+                    {
+                        xReturn = pdFAIL;
+                        break;
+                    }
+                }
             }
+        #endif /* configPOOL_CHECK_DOUBLE_FREE */
 
-            xReturn = pdPASS;
+        if( xReturn == pdPASS )
+        {
+            *( ( void ** ) pvBlock ) = pxPool->pvFreeList;
+            pxPool->pvFreeList = pvBlock;
         }
         else
         {
-            /* The mutex cannot be given because the calling task is not the
-             * holder. */
-            xReturn = pdFAIL;
-
-            traceGIVE_MUTEX_RECURSIVE_FAILED( pxMutex );
+            mtCOVERAGE_TEST_MARKER();
         }
 
         return xReturn;
     }
 
-#endif /* configUSE_RECURSIVE_MUTEXES */
+#endif /* configUSE_POOLS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+#if ( configUSE_POOLS == 1 )
 
-    BaseType_t xQueueTakeMutexRecursive( QueueHandle_t xMutex,
-                                         TickType_t xTicksToWait )
+    BaseType_t xPoolFree( PoolHandle_t xPool,
+                          void * pvBlock )
     {
+        Pool_t * const pxPool = xPool;
         BaseType_t xReturn;
-        Queue_t * const pxMutex = ( Queue_t * ) xMutex;
 
-        configASSERT( pxMutex );
+        configASSERT( pxPool );
+        configASSERT( pvBlock );
+        prvAssertBlockInPool( pxPool, pvBlock );
 
-        /* Comments regarding mutual exclusion as per those within
-         * xQueueGiveMutexRecursive(). */
+        taskENTER_CRITICAL();
+        {
+            xReturn = prvPushFreeBlock( pxPool, pvBlock );
+        }
+        taskEXIT_CRITICAL();
 
-        traceTAKE_MUTEX_RECURSIVE( pxMutex );
+        configASSERT( xReturn == pdPASS );
 
-        if( pxMutex->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() )
+        if( xReturn == pdPASS )
         {
-            ( pxMutex->u.xSemaphore.uxRecursiveCallCount )++;
-            xReturn = pdPASS;
+            /* The block is on the free list, so there is a count for it. */
+            xReturn = xQueueGenericSend( ( QueueHandle_t ) &( pxPool->xFreeBlockCount ), NULL, ( TickType_t ) 0, queueSEND_TO_BACK );
+            configASSERT( xReturn == pdPASS );
         }
         else
         {
-            xReturn = xQueueSemaphoreTake( pxMutex, xTicksToWait );
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-            /* pdPASS will only be returned if the mutex was successfully
-             * obtained.  The calling task may have entered the Blocked state
-             * before reaching here. */
-            if( xReturn != pdFAIL )
-            {
-                ( pxMutex->u.xSemaphore.uxRecursiveCallCount )++;
+        return xReturn;
+    }
+
+#endif /* configUSE_POOLS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POOLS == 1 )
+
+    BaseType_t xPoolFreeFromISR( PoolHandle_t xPool,
+                                 void * pvBlock,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        Pool_t * const pxPool = xPool;
+        BaseType_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxPool );
+        configASSERT( pvBlock );
+        prvAssertBlockInPool( pxPool, pvBlock );
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = prvPushFreeBlock( pxPool, pvBlock );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        configASSERT( xReturn == pdPASS );
+
+        if( xReturn == pdPASS )
+        {
+            xReturn = xQueueGiveFromISR( ( QueueHandle_t ) &( pxPool->xFreeBlockCount ), pxHigherPriorityTaskWoken );
+            configASSERT( xReturn == pdPASS );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_POOLS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_NOTIFY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    NotifyQueueHandle_t xNotifyQueueCreateStatic( UBaseType_t uxLength,
+                                                  uint32_t * pulStorage,
+                                                  StaticNotifyQueue_t * pxNotifyQueueBuffer )
+    {
+        NotifyQueue_t * pxNewNotifyQueue = NULL;
+        uint32_t ulSlot;
+
+        /* Positions wrap at 2^32, so the number of slots must divide 2^32 for
+         * every position to map onto the same slot on each lap.  With a single
+         * slot the sequence number of a slot that is free for position p and of
+         * one that holds the event for position p - 1 are both p, so at least
+         * two slots are needed. */
+        configASSERT( uxLength >= ( UBaseType_t ) 2 );
+        configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+        configASSERT( uxLength <= ( UBaseType_t ) 0x40000000UL );
+        configASSERT( pulStorage );
+        configASSERT( pxNotifyQueueBuffer );
+
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticNotifyQueue_t equals the size of the real
+                 * notify queue structure. */
+                volatile size_t xSize = sizeof( StaticNotifyQueue_t );
+                configASSERT( xSize == sizeof( NotifyQueue_t ) );
+                ( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+            }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pulStorage != NULL ) && ( pxNotifyQueueBuffer != NULL ) )
+        {
+            pxNewNotifyQueue = ( NotifyQueue_t * ) pxNotifyQueueBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+            pxNewNotifyQueue->ulHead = 0U;
+            pxNewNotifyQueue->ulTail = 0U;
+            pxNewNotifyQueue->ulMask = ( uint32_t ) uxLength - 1U;
+            pxNewNotifyQueue->pulSlots = pulStorage;
+            pxNewNotifyQueue->xTaskWaitingToReceive = NULL;
+
+            /* Each slot starts free for its position on the first lap. */
+            for( ulSlot = 0U; ulSlot < ( uint32_t ) uxLength; ulSlot++ )
+            {
+                pulStorage[ ulSlot * 2U ] = ulSlot;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( NotifyQueueHandle_t ) pxNewNotifyQueue;
+    }
+
+#endif /* ( ( configUSE_NOTIFY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+    static BaseType_t prvPostToNotifyQueue( NotifyQueue_t * const pxNotifyQueue,
+                                            const uint32_t ulEvent )
+    {
+        uint32_t ulPosition;
+        volatile uint32_t * pulSlot;
+        int32_t lLaps;
+        BaseType_t xReturn;
+
+        for( ; ; )
+        {
+            ulPosition = pxNotifyQueue->ulHead;
+            pulSlot = &( pxNotifyQueue->pulSlots[ ( ulPosition & pxNotifyQueue->ulMask ) * 2U ] );
+            lLaps = ( int32_t ) ( pulSlot[ 0 ] - ulPosition );
+
+            if( lLaps == 0 )
+            {
+                /* The slot is free for this position, so try to claim it.  This
+                 * fails if another poster claimed the position first. */
+                if( Atomic_CompareAndSwap_u32( &( pxNotifyQueue->ulHead ), ulPosition + 1U, ulPosition ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+                {
+                    pulSlot[ 1 ] = ulEvent;
+
+                    /* Publish the event.  The atomic increment also orders the
+                     * write of the event before the sequence number. */
+                    ( void ) Atomic_Increment_u32( &( pulSlot[ 0 ] ) );
+                    xReturn = pdPASS;
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( lLaps < 0 )
+            {
+                /* The slot still holds the event from the previous lap, which
+                 * has not been received, so the queue is full. */
+                xReturn = errQUEUE_FULL;
+                break;
+            }
+            else
+            {
+                /* Another poster claimed this position since ulHead was read. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Orders publishing the event before the check for a waiting receiver
+         * made by the caller.  The receiving task registers itself before it
+         * checks the queue again, so either it sees the event or the caller sees
+         * it waiting. */
+        portMEMORY_BARRIER();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_NOTIFY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+    BaseType_t xNotifyQueueSend( NotifyQueueHandle_t xNotifyQueue,
+                                 uint32_t ulEvent )
+    {
+        NotifyQueue_t * const pxNotifyQueue = xNotifyQueue;
+        TaskHandle_t xTaskToNotify;
+        BaseType_t xReturn;
+
+        configASSERT( pxNotifyQueue );
+
+        xReturn = prvPostToNotifyQueue( pxNotifyQueue, ulEvent );
+
+        if( xReturn == pdPASS )
+        {
+            xTaskToNotify = pxNotifyQueue->xTaskWaitingToReceive;
+
+            if( xTaskToNotify != NULL )
+            {
+                ( void ) xTaskNotifyIndexed( xTaskToNotify, configNOTIFY_QUEUE_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_NOTIFY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+    BaseType_t xNotifyQueueSendFromISR( NotifyQueueHandle_t xNotifyQueue,
+                                        uint32_t ulEvent,
+                                        BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        NotifyQueue_t * const pxNotifyQueue = xNotifyQueue;
+        TaskHandle_t xTaskToNotify;
+        BaseType_t xReturn;
+
+        configASSERT( pxNotifyQueue );
+
+        xReturn = prvPostToNotifyQueue( pxNotifyQueue, ulEvent );
+
+        if( xReturn == pdPASS )
+        {
+            /* Only lock the kernel if the receiving task has to be unblocked. */
+            xTaskToNotify = pxNotifyQueue->xTaskWaitingToReceive;
+
+            if( xTaskToNotify != NULL )
+            {
+                ( void ) xTaskNotifyIndexedFromISR( xTaskToNotify, configNOTIFY_QUEUE_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_NOTIFY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+    static BaseType_t prvIsNotifyQueueEventReady( const NotifyQueue_t * const pxNotifyQueue )
+    {
+        const uint32_t ulTail = pxNotifyQueue->ulTail;
+        BaseType_t xReturn;
+
+        if( pxNotifyQueue->pulSlots[ ( ulTail & pxNotifyQueue->ulMask ) * 2U ] == ( ulTail + 1U ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_NOTIFY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+    BaseType_t xNotifyQueueReceive( NotifyQueueHandle_t xNotifyQueue,
+                                    uint32_t * pulEvent,
+                                    TickType_t xTicksToWait )
+    {
+        NotifyQueue_t * const pxNotifyQueue = xNotifyQueue;
+        volatile uint32_t * pulSlot;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xReturn;
+        TimeOut_t xTimeOut;
+
+        configASSERT( pxNotifyQueue );
+        configASSERT( pulEvent );
+
+        /* Cannot block if the scheduler is suspended. */
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+            {
+                configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+            }
+        #endif
+
+        for( ; ; )
+        {
+            if( prvIsNotifyQueueEventReady( pxNotifyQueue ) != pdFALSE )
+            {
+                /* Only read the event once its sequence number shows it has
+                 * been published. */
+                portMEMORY_BARRIER();
+                pulSlot = &( pxNotifyQueue->pulSlots[ ( pxNotifyQueue->ulTail & pxNotifyQueue->ulMask ) * 2U ] );
+                *pulEvent = pulSlot[ 1 ];
+
+                /* Free the slot for the position one lap ahead.  The atomic add
+                 * also orders the read of the event before it. */
+                ( void ) Atomic_Add_u32( &( pulSlot[ 0 ] ), pxNotifyQueue->ulMask );
+                pxNotifyQueue->ulTail++;
+                xReturn = pdPASS;
+                break;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                xReturn = pdFAIL;
+                break;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                xReturn = pdFAIL;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Posters do not lock the kernel, so register as the waiting task
+             * before checking the queue again.  A notification left over from an
+             * earlier wait only causes an extra pass round the loop.  Waiting
+             * never changes the notification value. */
+            ( void ) xTaskNotifyStateClearIndexed( NULL, configNOTIFY_QUEUE_NOTIFICATION_INDEX );
+
+            /* Should only be one receiver. */
+            configASSERT( pxNotifyQueue->xTaskWaitingToReceive == NULL );
+            pxNotifyQueue->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            portMEMORY_BARRIER();
+
+            if( prvIsNotifyQueueEventReady( pxNotifyQueue ) == pdFALSE )
+            {
+                ( void ) xTaskNotifyWaitIndexed( configNOTIFY_QUEUE_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxNotifyQueue->xTaskWaitingToReceive = NULL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_NOTIFY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_NOTIFY_QUEUES == 1 )
+
+    UBaseType_t uxNotifyQueueMessagesWaiting( NotifyQueueHandle_t xNotifyQueue )
+    {
+        NotifyQueue_t * const pxNotifyQueue = xNotifyQueue;
+
+        configASSERT( pxNotifyQueue );
+
+        return ( UBaseType_t ) ( pxNotifyQueue->ulHead - pxNotifyQueue->ulTail );
+    }
+
+#endif /* configUSE_NOTIFY_QUEUES */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
+                                   const UBaseType_t uxItemSize,
+                                   uint8_t * pucQueueStorage,
+                                   const uint8_t ucQueueType,
+                                   Queue_t * pxNewQueue )
+{
+    /* Remove compiler warnings about unused parameters should
+     * configUSE_TRACE_FACILITY not be set to 1. */
+    ( void ) ucQueueType;
+
+    if( uxItemSize == ( UBaseType_t ) 0 )
+    {
+        /* No RAM was allocated for the queue storage area, but PC head cannot
+         * be set to NULL because NULL is used as a key to say the queue is used as
+         * a mutex.  Therefore just set pcHead to point to the queue as a benign
+         * value that is known to be within the memory map. */
+        pxNewQueue->pcHead = ( int8_t * ) pxNewQueue;
+    }
+    else
+    {
+        /* Set the head to the start of the queue storage area. */
+        pxNewQueue->pcHead = ( int8_t * ) pucQueueStorage;
+    }
+
+    /* Initialise the queue members as described where the queue type is
+     * defined. */
+    pxNewQueue->uxLength = uxQueueLength;
+    pxNewQueue->uxItemSize = uxItemSize;
+    ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
+
+    #if ( configUSE_TRACE_FACILITY == 1 )
+        {
+            pxNewQueue->ucQueueType = ucQueueType;
+        }
+    #endif /* configUSE_TRACE_FACILITY */
+
+    #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            pxNewQueue->pxQueueSetContainer = NULL;
+        }
+    #endif /* configUSE_QUEUE_SETS */
+
+    #if ( configUSE_BUFFER_QUEUES == 1 )
+        {
+            pxNewQueue->pxBufferPool = NULL;
+        }
+    #endif /* configUSE_BUFFER_QUEUES */
+
+    traceQUEUE_CREATE( pxNewQueue );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+    static void prvInitialiseMutex( Queue_t * pxNewQueue )
+    {
+        if( pxNewQueue != NULL )
+        {
+            /* The queue create function will set all the queue structure members
+            * correctly for a generic queue, but this function is creating a
+            * mutex.  Overwrite those members that need to be set differently -
+            * in particular the information required for priority inheritance. */
+            pxNewQueue->u.xSemaphore.xMutexHolder = NULL;
+            pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
+
+            /* In case this is a recursive mutex. */
+            pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
+
+            traceCREATE_MUTEX( pxNewQueue );
+
+            /* Start with the semaphore in the expected state. */
+            ( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+        }
+        else
+        {
+            traceCREATE_MUTEX_FAILED();
+        }
+    }
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
+    {
+        QueueHandle_t xNewQueue;
+        const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+        xNewQueue = xQueueGenericCreate( uxMutexLength, uxMutexSize, ucQueueType );
+        prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+
+        return xNewQueue;
+    }
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType,
+                                           StaticQueue_t * pxStaticQueue )
+    {
+        QueueHandle_t xNewQueue;
+        const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+        /* Prevent compiler warnings about unused parameters if
+         * configUSE_TRACE_FACILITY does not equal 1. */
+        ( void ) ucQueueType;
+
+        xNewQueue = xQueueGenericCreateStatic( uxMutexLength, uxMutexSize, NULL, pxStaticQueue, ucQueueType );
+        prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+
+        return xNewQueue;
+    }
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
+
+    TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore )
+    {
+        TaskHandle_t pxReturn;
+        Queue_t * const pxSemaphore = ( Queue_t * ) xSemaphore;
+
+        /* This function is called by xSemaphoreGetMutexHolder(), and should not
+         * be called directly.  Note:  This is a good way of determining if the
+         * calling task is the mutex holder, but not a good way of determining the
+         * identity of the mutex holder, as the holder may change between the
+         * following critical section exiting and the function returning. */
+        taskENTER_CRITICAL();
+        {
+            if( pxSemaphore->uxQueueType == queueQUEUE_IS_MUTEX )
+            {
+                pxReturn = pxSemaphore->u.xSemaphore.xMutexHolder;
+            }
+            else
+            {
+                pxReturn = NULL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return pxReturn;
+    } /*lint !e818 xSemaphore cannot be a pointer to const because it is a typedef. */
+
+#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
+
+    TaskHandle_t xQueueGetMutexHolderFromISR( QueueHandle_t xSemaphore )
+    {
+        TaskHandle_t pxReturn;
+
+        configASSERT( xSemaphore );
+
+        /* Mutexes cannot be used in interrupt service routines, so the mutex
+         * holder should not change in an ISR, and therefore a critical section is
+         * not required here. */
+        if( ( ( Queue_t * ) xSemaphore )->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            pxReturn = ( ( Queue_t * ) xSemaphore )->u.xSemaphore.xMutexHolder;
+        }
+        else
+        {
+            pxReturn = NULL;
+        }
+
+        return pxReturn;
+    } /*lint !e818 xSemaphore cannot be a pointer to const because it is a typedef. */
+
+#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+
+    BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+
+        configASSERT( pxMutex );
+
+        /* If this is the task that holds the mutex then xMutexHolder will not
+         * change outside of this task.  If this task does not hold the mutex then
+         * pxMutexHolder can never coincidentally equal the tasks handle, and as
+         * this is the only condition we are interested in it does not matter if
+         * pxMutexHolder is accessed simultaneously by another task.  Therefore no
+         * mutual exclusion is required to test the pxMutexHolder variable. */
+        if( pxMutex->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() )
+        {
+            traceGIVE_MUTEX_RECURSIVE( pxMutex );
+
+            /* uxRecursiveCallCount cannot be zero if xMutexHolder is equal to
+             * the task handle, therefore no underflow check is required.  Also,
+             * uxRecursiveCallCount is only modified by the mutex holder, and as
+             * there can only be one, no mutual exclusion is required to modify the
+             * uxRecursiveCallCount member. */
+            ( pxMutex->u.xSemaphore.uxRecursiveCallCount )--;
+
+            /* Has the recursive call count unwound to 0? */
+            if( pxMutex->u.xSemaphore.uxRecursiveCallCount == ( UBaseType_t ) 0 )
+            {
+                /* Return the mutex.  This will automatically unblock any other
+                 * task that might be waiting to access the mutex. */
+                ( void ) xQueueGenericSend( pxMutex, NULL, queueMUTEX_GIVE_BLOCK_TIME, queueSEND_TO_BACK );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            /* The mutex cannot be given because the calling task is not the
+             * holder. */
+            xReturn = pdFAIL;
+
+            traceGIVE_MUTEX_RECURSIVE_FAILED( pxMutex );
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_RECURSIVE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+
+    BaseType_t xQueueTakeMutexRecursive( QueueHandle_t xMutex,
+                                         TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+
+        configASSERT( pxMutex );
+
+        /* Comments regarding mutual exclusion as per those within
+         * xQueueGiveMutexRecursive(). */
+
+        traceTAKE_MUTEX_RECURSIVE( pxMutex );
+
+        if( pxMutex->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() )
+        {
+            ( pxMutex->u.xSemaphore.uxRecursiveCallCount )++;
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = xQueueSemaphoreTake( pxMutex, xTicksToWait );
+
+            /* pdPASS will only be returned if the mutex was successfully
+             * obtained.  The calling task may have entered the Blocked state
+             * before reaching here. */
+            if( xReturn != pdFAIL )
+            {
+                ( pxMutex->u.xSemaphore.uxRecursiveCallCount )++;
             }
             else
             {
@@ -871,10 +1648,176 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                         {
                             if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
-                                /* The unblocked task has a priority higher than
-                                 * our own so yield immediately.  Yes it is ok to do
-                                 * this from within the critical section - the kernel
-                                 * takes care of that. */
+                                /* The unblocked task has a priority higher than
+                                 * our own so yield immediately.  Yes it is ok to do
+                                 * this from within the critical section - the kernel
+                                 * takes care of that. */
+                                queueYIELD_IF_USING_PREEMPTION();
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else if( xYieldRequired != pdFALSE )
+                        {
+                            /* This path is a special case that will only get
+                             * executed if the task was holding multiple mutexes and
+                             * the mutexes were given back in an order that is
+                             * different to that in which they were taken. */
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configUSE_QUEUE_SETS */
+
+                taskEXIT_CRITICAL();
+                return pdPASS;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was full and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    taskEXIT_CRITICAL();
+
+                    /* Return to the original privilege level before exiting
+                     * the function. */
+                    traceQUEUE_SEND_FAILED( pxQueue );
+                    return errQUEUE_FULL;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The queue was full and a block time was specified so
+                     * configure the timeout structure. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Interrupts and other tasks can send to and receive from the queue
+         * now the critical section has been exited. */
+
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+                /* Unlocking the queue means queue events can effect the
+                 * event list.  It is possible that interrupts occurring now
+                 * remove this task from the event list again - but as the
+                 * scheduler is suspended the task will go onto the pending
+                 * ready last instead of the actual ready list. */
+                prvUnlockQueue( pxQueue );
+
+                /* Resuming the scheduler will move tasks from the pending
+                 * ready list into the ready list - so it is feasible that this
+                 * task is already in a ready list before it yields - in which
+                 * case the yield will not cause a context switch unless there
+                 * is also a higher priority task in the pending ready list. */
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    portYIELD_WITHIN_API();
+                }
+            }
+            else
+            {
+                /* Try again. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* The timeout has expired. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            traceQUEUE_SEND_FAILED( pxQueue );
+            return errQUEUE_FULL;
+        }
+    } /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+                                 const void * const pvItemsToQueue,
+                                 const UBaseType_t uxItemCount,
+                                 TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+    Queue_t * const pxQueue = xQueue;
+    UBaseType_t uxItemsSent;
+
+    configASSERT( pxQueue );
+    configASSERT( pvItemsToQueue );
+    configASSERT( uxItemCount > ( UBaseType_t ) 0U );
+
+    /* Semaphores and mutexes do not hold data, so cannot be sent to in bulk. */
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+    #endif
+
+    /*lint -save -e904 This function relaxes the coding standard somewhat to
+     * allow return statements within the function itself.  This is done in the
+     * interest of execution time efficiency. */
+    for( ; ; )
+    {
+        taskENTER_CRITICAL();
+        {
+            /* Is there room for at least one item?  As many items as fit are
+             * sent, so the call only blocks while the queue is full. */
+            if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+            {
+                uxItemsSent = configMIN( uxItemCount, pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+                prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemsSent );
+                traceQUEUE_SEND( pxQueue );
+
+                #if ( configUSE_QUEUE_SETS == 1 )
+                    {
+                        if( pxQueue->pxQueueSetContainer != NULL )
+                        {
+                            UBaseType_t uxItem;
+                            BaseType_t xYieldRequired = pdFALSE;
+
+                            /* The queue set holds one entry for each item in
+                             * each of its member queues. */
+                            for( uxItem = ( UBaseType_t ) 0; uxItem < uxItemsSent; uxItem++ )
+                            {
+                                if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                                {
+                                    xYieldRequired = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+
+                            if( xYieldRequired != pdFALSE )
+                            {
                                 queueYIELD_IF_USING_PREEMPTION();
                             }
                             else
@@ -882,12 +1825,21 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                                 mtCOVERAGE_TEST_MARKER();
                             }
                         }
-                        else if( xYieldRequired != pdFALSE )
+                        else if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemsSent ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #else /* configUSE_QUEUE_SETS */
+                    {
+                        /* Unblock tasks waiting for data to arrive on the
+                         * queue, yielding once for the whole batch. */
+                        if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToReceive ), uxItemsSent ) != pdFALSE )
                         {
-                            /* This path is a special case that will only get
-                             * executed if the task was holding multiple mutexes and
-                             * the mutexes were given back in an order that is
-                             * different to that in which they were taken. */
                             queueYIELD_IF_USING_PREEMPTION();
                         }
                         else
@@ -898,7 +1850,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 #endif /* configUSE_QUEUE_SETS */
 
                 taskEXIT_CRITICAL();
-                return pdPASS;
+                return uxItemsSent;
             }
             else
             {
@@ -907,11 +1859,8 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                     /* The queue was full and no block time is specified (or
                      * the block time has expired) so leave now. */
                     taskEXIT_CRITICAL();
-
-                    /* Return to the original privilege level before exiting
-                     * the function. */
                     traceQUEUE_SEND_FAILED( pxQueue );
-                    return errQUEUE_FULL;
+                    return ( UBaseType_t ) 0;
                 }
                 else if( xEntryTimeSet == pdFALSE )
                 {
@@ -942,19 +1891,8 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             {
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
-
-                /* Unlocking the queue means queue events can effect the
-                 * event list.  It is possible that interrupts occurring now
-                 * remove this task from the event list again - but as the
-                 * scheduler is suspended the task will go onto the pending
-                 * ready last instead of the actual ready list. */
                 prvUnlockQueue( pxQueue );
 
-                /* Resuming the scheduler will move tasks from the pending
-                 * ready list into the ready list - so it is feasible that this
-                 * task is already in a ready list before it yields - in which
-                 * case the yield will not cause a context switch unless there
-                 * is also a higher priority task in the pending ready list. */
                 if( xTaskResumeAll() == pdFALSE )
                 {
                     portYIELD_WITHIN_API();
@@ -974,7 +1912,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             ( void ) xTaskResumeAll();
 
             traceQUEUE_SEND_FAILED( pxQueue );
-            return errQUEUE_FULL;
+            return ( UBaseType_t ) 0;
         }
     } /*lint -restore */
 }
@@ -1458,6 +2396,143 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
+UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                    void * const pvBuffer,
+                                    const UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+    Queue_t * const pxQueue = xQueue;
+    UBaseType_t uxItemsReceived;
+
+    configASSERT( pxQueue );
+    configASSERT( pvBuffer );
+    configASSERT( uxMaxItems > ( UBaseType_t ) 0U );
+
+    /* Semaphores and mutexes do not hold data, so cannot be received from in
+     * bulk. */
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+    #endif
+
+    /*lint -save -e904  This function relaxes the coding standard somewhat to
+     * allow return statements within the function itself.  This is done in the
+     * interest of execution time efficiency. */
+    for( ; ; )
+    {
+        taskENTER_CRITICAL();
+        {
+            const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+            /* Is there data in the queue now?  As many items as are available
+             * are received, so the call only blocks while the queue is empty. */
+            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            {
+                uxItemsReceived = configMIN( uxMaxItems, uxMessagesWaiting );
+                prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxItemsReceived );
+                traceQUEUE_RECEIVE( pxQueue );
+                pxQueue->uxMessagesWaiting = uxMessagesWaiting - uxItemsReceived;
+
+                /* There is now space in the queue, so unblock tasks waiting to
+                 * post to the queue, yielding once for the whole batch. */
+                if( prvUnblockWaitingTasks( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                taskEXIT_CRITICAL();
+                return uxItemsReceived;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was empty and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    taskEXIT_CRITICAL();
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    return ( UBaseType_t ) 0;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The queue was empty and a block time was specified so
+                     * configure the timeout structure. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Interrupts and other tasks can send to and receive from the queue
+         * now the critical section has been exited. */
+
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            /* The timeout has not expired.  If the queue is still empty place
+             * the task on the list of tasks waiting to receive from the queue. */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    portYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The queue contains data again.  Loop back to try and read the
+                 * data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* Timed out.  If there is no data in the queue exit, otherwise loop
+             * back and attempt to read the data. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                return ( UBaseType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    } /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                                 TickType_t xTicksToWait )
 {
@@ -2030,6 +3105,20 @@ void vQueueDelete( QueueHandle_t xQueue )
     configASSERT( pxQueue );
     traceQUEUE_DELETE( pxQueue );
 
+    #if ( configUSE_BUFFER_QUEUES == 1 )
+        {
+            /* The pool of a buffer queue is freed along with the queue. */
+            if( pxQueue->pxBufferPool != NULL )
+            {
+                traceQUEUE_DELETE( pxQueue->pxBufferPool );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configUSE_BUFFER_QUEUES */
+
     #if ( configQUEUE_REGISTRY_SIZE > 0 )
         {
             vQueueUnregisterQueue( pxQueue );
@@ -2065,6 +3154,79 @@ void vQueueDelete( QueueHandle_t xQueue )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_BUFFER_QUEUES == 1 )
+
+    BaseType_t xQueueAcquireBuffer( QueueHandle_t xQueue,
+                                    void ** ppvBuffer,
+                                    TickType_t xTicksToWait )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->pxBufferPool != NULL );
+        configASSERT( ppvBuffer );
+
+        return xQueueReceive( pxQueue->pxBufferPool, ppvBuffer, xTicksToWait );
+    }
+
+#endif /* configUSE_BUFFER_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+
+    BaseType_t xQueueSendBuffer( QueueHandle_t xQueue,
+                                 void * pvBuffer )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->pxBufferPool != NULL );
+        configASSERT( pvBuffer );
+
+        /* There are only as many buffers as the queue can hold, so the queue
+         * cannot be full and there is never a need to block. */
+        return xQueueGenericSend( pxQueue, &pvBuffer, ( TickType_t ) 0, queueSEND_TO_BACK );
+    }
+
+#endif /* configUSE_BUFFER_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+
+    BaseType_t xQueueReceiveBuffer( QueueHandle_t xQueue,
+                                    void ** ppvBuffer,
+                                    TickType_t xTicksToWait )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->pxBufferPool != NULL );
+        configASSERT( ppvBuffer );
+
+        return xQueueReceive( pxQueue, ppvBuffer, xTicksToWait );
+    }
+
+#endif /* configUSE_BUFFER_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BUFFER_QUEUES == 1 )
+
+    BaseType_t xQueueReleaseBuffer( QueueHandle_t xQueue,
+                                    void * pvBuffer )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->pxBufferPool != NULL );
+        configASSERT( pvBuffer );
+
+        /* As with xQueueSendBuffer(), the pool has room for every buffer. */
+        return xQueueGenericSend( pxQueue->pxBufferPool, &pvBuffer, ( TickType_t ) 0, queueSEND_TO_BACK );
+    }
+
+#endif /* configUSE_BUFFER_QUEUES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TRACE_FACILITY == 1 )
 
     UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
@@ -2227,6 +3389,112 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                    const void * pvItemsToQueue,
+                                    const UBaseType_t uxItemCount )
+{
+    size_t xBytes, xFirstBytes;
+
+    /* This function is called from a critical section. */
+
+    xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+
+    /* Copy up to the end of the storage area, then wrap to the start. */
+    xFirstBytes = configMIN( xBytes, ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo ) );
+    ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemsToQueue, xFirstBytes ); /*lint !e961 !e418 !e9087 Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+    pxQueue->pcWriteTo += xFirstBytes;                                              /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+    if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+    {
+        pxQueue->pcWriteTo = pxQueue->pcHead;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xBytes > xFirstBytes )
+    {
+        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) ( ( const uint8_t * ) pvItemsToQueue + xFirstBytes ), xBytes - xFirstBytes ); /*lint !e961 !e418 !e9087 !e9016 See above. */
+        pxQueue->pcWriteTo += xBytes - xFirstBytes;                                                                                                 /*lint !e9016 See above. */
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxQueue->uxMessagesWaiting += uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                      void * const pvBuffer,
+                                      const UBaseType_t uxItemCount )
+{
+    size_t xBytes, xFirstBytes;
+    int8_t * pcReadFrom;
+
+    /* This function is called from a critical section.  pcReadFrom points to
+     * the last item read, so the first item to read is the one after it. */
+
+    xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+    pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+    if( pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+    {
+        pcReadFrom = pxQueue->pcHead;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Copy up to the end of the storage area, then wrap to the start. */
+    xFirstBytes = configMIN( xBytes, ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom ) );
+    ( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xFirstBytes ); /*lint !e961 !e418 !e9087 Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+    pcReadFrom += xFirstBytes;                                       /*lint !e9016 See above. */
+
+    if( xBytes > xFirstBytes )
+    {
+        ( void ) memcpy( ( void * ) ( ( uint8_t * ) pvBuffer + xFirstBytes ), ( void * ) pxQueue->pcHead, xBytes - xFirstBytes ); /*lint !e961 !e418 !e9087 !e9016 See above. */
+        pcReadFrom = pxQueue->pcHead + ( xBytes - xFirstBytes );                                                                   /*lint !e9016 See above. */
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Leave pcReadFrom pointing to the last item read. */
+    pxQueue->u.xQueue.pcReadFrom = pcReadFrom - pxQueue->uxItemSize; /*lint !e9016 See above. */
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockWaitingTasks( List_t * const pxEventList,
+                                          UBaseType_t uxMaxTasks )
+{
+    BaseType_t xYieldRequired = pdFALSE;
+
+    /* This function is called from a critical section.  Each item can satisfy
+     * one waiting task, so wake no more tasks than there were items, and let the
+     * caller yield once however many tasks were woken. */
+    while( ( uxMaxTasks > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+    {
+        if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+        {
+            xYieldRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxMaxTasks--;
+    }
+
+    return xYieldRequired;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -125,6 +125,151 @@
         portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );                    \
     }
 #endif /* sbSEND_COMPLETE_FROM_ISR */
+
+#if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+
+/* A channel is shared with another kernel instance, so the task handles it
+ * holds may belong to either kernel.  Completing a send or receive on a channel
+ * therefore rings the other instance's doorbell instead of notifying a task
+ * directly.  The doorbell interrupt on the other instance then calls
+ * xStreamBufferSendCompletedFromISR() or xStreamBufferReceiveCompletedFromISR()
+ * to unblock its own task. */
+    #ifndef sbCHANNEL_SEND_COMPLETED
+        #error sbCHANNEL_SEND_COMPLETED() must be defined in FreeRTOSConfig.h if configUSE_STREAM_BUFFER_CHANNELS is set to 1
+    #endif
+
+    #ifndef sbCHANNEL_RECEIVE_COMPLETED
+        #error sbCHANNEL_RECEIVE_COMPLETED() must be defined in FreeRTOSConfig.h if configUSE_STREAM_BUFFER_CHANNELS is set to 1
+    #endif
+
+/* Orders accesses to the storage area against the head and tail updates that
+ * publish them to the other kernel instance.  Override with a hardware memory
+ * barrier if the cores do not observe each other's writes in order. */
+    #ifndef sbCHANNEL_MEMORY_BARRIER
+        #define sbCHANNEL_MEMORY_BARRIER()    portMEMORY_BARRIER()
+    #endif
+
+    #define prvNOTIFY_SEND_COMPLETED( pxStreamBuffer )                                    \
+    if( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_CHANNEL ) != ( uint8_t ) 0 )           \
+    {                                                                                     \
+        sbCHANNEL_SEND_COMPLETED( ( pxStreamBuffer ) );                                   \
+    }                                                                                     \
+    else                                                                                  \
+    {                                                                                     \
+        sbSEND_COMPLETED( ( pxStreamBuffer ) );                                           \
+    }
+
+    #define prvNOTIFY_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
+    if( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_CHANNEL ) != ( uint8_t ) 0 )           \
+    {                                                                                     \
+        sbCHANNEL_SEND_COMPLETED( ( pxStreamBuffer ) );                                   \
+    }                                                                                     \
+    else                                                                                  \
+    {                                                                                     \
+        sbSEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) );    \
+    }
+
+    #define prvNOTIFY_RECEIVE_COMPLETED( pxStreamBuffer )                                 \
+    if( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_CHANNEL ) != ( uint8_t ) 0 )           \
+    {                                                                                     \
+        sbCHANNEL_RECEIVE_COMPLETED( ( pxStreamBuffer ) );                                \
+    }                                                                                     \
+    else                                                                                  \
+    {                                                                                     \
+        sbRECEIVE_COMPLETED( ( pxStreamBuffer ) );                                        \
+    }
+
+    #define prvNOTIFY_RECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
+    if( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_CHANNEL ) != ( uint8_t ) 0 )           \
+    {                                                                                     \
+        sbCHANNEL_RECEIVE_COMPLETED( ( pxStreamBuffer ) );                                \
+    }                                                                                     \
+    else                                                                                  \
+    {                                                                                     \
+        sbRECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) ); \
+    }
+#else /* configUSE_STREAM_BUFFER_CHANNELS */
+    #define prvNOTIFY_SEND_COMPLETED( pxStreamBuffer )                                        sbSEND_COMPLETED( ( pxStreamBuffer ) )
+    #define prvNOTIFY_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )     sbSEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+    #define prvNOTIFY_RECEIVE_COMPLETED( pxStreamBuffer )                                     sbRECEIVE_COMPLETED( ( pxStreamBuffer ) )
+    #define prvNOTIFY_RECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) sbRECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+#endif /* configUSE_STREAM_BUFFER_CHANNELS */
+
+#if ( configUSE_STREAM_BUFFER_FAST_PATH == 1 )
+
+/* Orders a head or tail update before the following check for a task waiting
+ * on the other end of the buffer.  Must be a full hardware memory barrier if
+ * the writer and reader can run on different cores. */
+    #ifndef sbFULL_MEMORY_BARRIER
+        #if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+            #define sbFULL_MEMORY_BARRIER()    sbCHANNEL_MEMORY_BARRIER()
+        #else
+            #define sbFULL_MEMORY_BARRIER()    portMEMORY_BARRIER()
+        #endif
+    #endif
+
+/* The writer and reader only lock the kernel to notify the other end if they
+ * see a task waiting there.  A task that is about to wait registers itself and
+ * then checks the buffer again, with a barrier in between, so either that
+ * check sees the update or the update's check sees the waiting task. */
+    #define prvSEND_COMPLETED( pxStreamBuffer )                                     \
+    {                                                                               \
+        sbFULL_MEMORY_BARRIER();                                                    \
+                                                                                    \
+        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )                     \
+        {                                                                           \
+            prvNOTIFY_SEND_COMPLETED( ( pxStreamBuffer ) );                         \
+        }                                                                           \
+    }
+
+    #define prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )  \
+    {                                                                               \
+        sbFULL_MEMORY_BARRIER();                                                    \
+                                                                                    \
+        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )                     \
+        {                                                                           \
+            prvNOTIFY_SEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ),                   \
+                                              ( pxHigherPriorityTaskWoken ) );      \
+        }                                                                           \
+    }
+
+    #define prvRECEIVE_COMPLETED( pxStreamBuffer )                                  \
+    {                                                                               \
+        sbFULL_MEMORY_BARRIER();                                                    \
+                                                                                    \
+        if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )                        \
+        {                                                                           \
+            prvNOTIFY_RECEIVE_COMPLETED( ( pxStreamBuffer ) );                      \
+        }                                                                           \
+    }
+
+    #define prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
+    {                                                                                  \
+        sbFULL_MEMORY_BARRIER();                                                       \
+                                                                                       \
+        if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )                           \
+        {                                                                              \
+            prvNOTIFY_RECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ),                  \
+                                                  ( pxHigherPriorityTaskWoken ) );     \
+        }                                                                              \
+    }
+#else /* configUSE_STREAM_BUFFER_FAST_PATH */
+    #define prvSEND_COMPLETED( pxStreamBuffer )                                           prvNOTIFY_SEND_COMPLETED( ( pxStreamBuffer ) )
+    #define prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )        prvNOTIFY_SEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+    #define prvRECEIVE_COMPLETED( pxStreamBuffer )                                        prvNOTIFY_RECEIVE_COMPLETED( ( pxStreamBuffer ) )
+    #define prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )    prvNOTIFY_RECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+#endif /* configUSE_STREAM_BUFFER_FAST_PATH */
+
+/* Orders accesses to the storage area against the head and tail updates that
+ * publish them, when the other end of the buffer can read the indices without
+ * holding a lock. */
+#if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+    #define prvINDEX_MEMORY_BARRIER()    sbCHANNEL_MEMORY_BARRIER()
+#elif ( configUSE_STREAM_BUFFER_FAST_PATH == 1 )
+    #define prvINDEX_MEMORY_BARRIER()    portMEMORY_BARRIER()
+#else
+    #define prvINDEX_MEMORY_BARRIER()
+#endif
 /*lint -restore (9026) */
 
 /* The number of bytes used to hold the length of a message in the buffer. */
@@ -133,6 +278,7 @@
 /* Bits stored in the ucFlags field of the stream buffer. */
 #define sbFLAGS_IS_MESSAGE_BUFFER          ( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
 #define sbFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+#define sbFLAGS_IS_CHANNEL                 ( ( uint8_t ) 4 ) /* Set if the stream buffer was created as a channel, in which case it is shared with another kernel instance. */
 
 /*-----------------------------------------------------------*/
 
@@ -159,14 +305,16 @@ typedef struct StreamBufferDef_t                 /*lint !e9058 Style convention
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
 
 /*
- * Add xCount bytes from pucData into the pxStreamBuffer message buffer.
- * Returns the number of bytes written, which will either equal xCount in the
- * success case, or 0 if there was not enough space in the buffer (in which case
- * no data is written into the buffer).
+ * Copy xCount bytes from pucData into the pxStreamBuffer storage area, starting
+ * at index xHead.  Returns the index of the byte following the bytes written.
+ * The head of the buffer is not updated, so the bytes are not visible to the
+ * reader until the caller sets the head to the returned value.  There must be
+ * at least xCount bytes of space in the buffer.
  */
 static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
                                      const uint8_t * pucData,
-                                     size_t xCount ) PRIVILEGED_FUNCTION;
+                                     size_t xCount,
+                                     size_t xHead ) PRIVILEGED_FUNCTION;
 
 /*
  * If the stream buffer is being used as a message buffer, then reads an entire
@@ -195,13 +343,32 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
                                        size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
 
 /*
- * Read xMaxCount bytes from the pxStreamBuffer message buffer and write them
- * to pucData.
+ * Copy xCount bytes from the pxStreamBuffer storage area, starting at index
+ * xTail, into pucData.  Returns the index of the byte following the bytes read.
+ * The tail of the buffer is not updated, so the space is not released to the
+ * writer until the caller sets the tail to the returned value.  There must be
+ * at least xCount bytes in the buffer.
  */
 static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       uint8_t * pucData,
-                                      size_t xMaxCount,
-                                      size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+                                      size_t xCount,
+                                      size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Makes xDataLengthBytes bytes previously returned by xStreamBufferReserve()
+ * available to the reader, first writing the message length if the stream
+ * buffer is being used as a message buffer.
+ */
+static size_t prvCommitToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Releases xDataLengthBytes bytes previously returned by
+ * xStreamBufferPeekContiguous() back to the writer, along with the message
+ * length if the stream buffer is being used as a message buffer.
+ */
+static size_t prvConsumeFromBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                    size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
 
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
@@ -368,6 +535,64 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 #endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+
+    StreamBufferHandle_t xStreamBufferGenericCreateChannel( size_t xBufferSizeBytes,
+                                                            size_t xTriggerLevelBytes,
+                                                            BaseType_t xIsMessageBuffer,
+                                                            uint8_t * const pucStreamBufferStorageArea,
+                                                            StaticStreamBuffer_t * const pxStaticStreamBuffer )
+    {
+        StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) pxStaticStreamBuffer; /*lint !e740 !e9087 Safe cast as StaticStreamBuffer_t is opaque Streambuffer_t. */
+        StreamBufferHandle_t xReturn;
+
+        xReturn = xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, xIsMessageBuffer, pucStreamBufferStorageArea, pxStaticStreamBuffer );
+
+        if( xReturn != NULL )
+        {
+            /* The flag is set last as xStreamBufferOpenChannel() uses it to
+             * know the rest of the structure is valid. */
+            sbCHANNEL_MEMORY_BARRIER();
+            pxStreamBuffer->ucFlags |= sbFLAGS_IS_CHANNEL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_CHANNELS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_CHANNELS == 1 )
+
+    StreamBufferHandle_t xStreamBufferOpenChannel( StaticStreamBuffer_t * const pxStaticStreamBuffer )
+    {
+        const StreamBuffer_t * const pxStreamBuffer = ( const StreamBuffer_t * ) pxStaticStreamBuffer; /*lint !e740 !e9087 Safe cast as StaticStreamBuffer_t is opaque Streambuffer_t. */
+        StreamBufferHandle_t xReturn;
+
+        configASSERT( pxStaticStreamBuffer );
+
+        /* The channel is created by the other kernel instance, which might
+         * not have done so yet. */
+        if( ( *( ( volatile const uint8_t * ) &( pxStreamBuffer->ucFlags ) ) & sbFLAGS_IS_CHANNEL ) != ( uint8_t ) 0 )
+        {
+            sbCHANNEL_MEMORY_BARRIER();
+            xReturn = ( StreamBufferHandle_t ) pxStaticStreamBuffer; /*lint !e9087 Data hiding requires cast to opaque type. */
+        }
+        else
+        {
+            xReturn = NULL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_CHANNELS */
+/*-----------------------------------------------------------*/
+
 void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
 {
     StreamBuffer_t * pxStreamBuffer = xStreamBuffer;
@@ -572,6 +797,23 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         }
     }
 
+    #if ( configUSE_STREAM_BUFFER_FAST_PATH == 1 )
+    {
+        /* Only the writer moves the head, so if there is already enough space
+         * there is no need to enter a critical section to check again. */
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+        if( xSpace >= xRequiredSpace )
+        {
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_STREAM_BUFFER_FAST_PATH */
+
     if( xTicksToWait != ( TickType_t ) 0 )
     {
         vTaskSetTimeOutState( &xTimeOut );
@@ -592,6 +834,27 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                     /* Should only be one writer. */
                     configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
                     pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+
+                    #if ( configUSE_STREAM_BUFFER_FAST_PATH == 1 )
+                    {
+                        /* The reader does not enter a critical section, so it
+                         * may have freed space before it could see this task
+                         * waiting.  Check again after the barrier. */
+                        sbFULL_MEMORY_BARRIER();
+                        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+                        if( xSpace >= xRequiredSpace )
+                        {
+                            pxStreamBuffer->xTaskWaitingToSend = NULL;
+                            taskEXIT_CRITICAL();
+                            break;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif /* configUSE_STREAM_BUFFER_FAST_PATH */
                 }
                 else
                 {
@@ -629,7 +892,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         /* Was a task waiting for the data? */
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
-            sbSEND_COMPLETED( pxStreamBuffer );
+            prvSEND_COMPLETED( pxStreamBuffer );
         }
         else
         {
@@ -679,7 +942,7 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
         /* Was a task waiting for the data? */
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
-            sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
         else
         {
@@ -705,6 +968,11 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 {
     BaseType_t xShouldWrite;
     size_t xReturn;
+    size_t xNextHead = pxStreamBuffer->xHead;
+
+    /* xSpace was calculated from the tail, which must be read before the
+     * storage area is written. */
+    prvINDEX_MEMORY_BARRIER();
 
     if( xSpace == ( size_t ) 0 )
     {
@@ -727,7 +995,7 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
          * into the buffer.  Start by writing the length of the data, the data
          * itself will be written later in this function. */
         xShouldWrite = pdTRUE;
-        ( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH );
+        xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
     }
     else
     {
@@ -738,7 +1006,13 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
     if( xShouldWrite != pdFALSE )
     {
         /* Writes the data itself. */
-        xReturn = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alignment and access. */
+        xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xNextHead ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alignment and access. */
+
+        /* Only update the head once the whole message has been written, so
+         * the reader never sees the length of a message without its data. */
+        prvINDEX_MEMORY_BARRIER();
+        pxStreamBuffer->xHead = xNextHead;
+        xReturn = xDataLengthBytes;
     }
     else
     {
@@ -749,6 +1023,189 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                             void ** ppvData,
+                             size_t xDataLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn, xSpace, xStart, xContiguous;
+
+    configASSERT( ppvData );
+    configASSERT( pxStreamBuffer );
+
+    xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+    xStart = pxStreamBuffer->xHead;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* The length of the message is written in front of it when the message
+         * is committed, so the message itself starts after the length. */
+        xStart += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+        if( xStart >= pxStreamBuffer->xLength )
+        {
+            xStart -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* The region handed to the caller cannot wrap past the end of the storage
+     * area. */
+    xContiguous = pxStreamBuffer->xLength - xStart;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+    {
+        /* This is a stream buffer, so reserve as many bytes as possible. */
+        xReturn = configMIN( xDataLengthBytes, configMIN( xSpace, xContiguous ) );
+    }
+    else if( ( xSpace >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) ) &&
+             ( xContiguous >= xDataLengthBytes ) )
+    {
+        /* This is a message buffer, and the whole message and its length
+         * fit. */
+        xReturn = xDataLengthBytes;
+    }
+    else
+    {
+        xReturn = 0;
+    }
+
+    if( xReturn != ( size_t ) 0 )
+    {
+        /* xSpace was calculated from the tail, which must be read before the
+         * caller writes to the storage area. */
+        prvINDEX_MEMORY_BARRIER();
+        *ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ xStart ] );
+    }
+    else
+    {
+        *ppvData = NULL;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+                            size_t xDataLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvCommitToBuffer( pxStreamBuffer, xDataLengthBytes );
+
+    if( xReturn > ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+        /* Was a task waiting for the data? */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            prvSEND_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                   size_t xDataLengthBytes,
+                                   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvCommitToBuffer( pxStreamBuffer, xDataLengthBytes );
+
+    if( xReturn > ( size_t ) 0 )
+    {
+        /* Was a task waiting for the data? */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvCommitToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xDataLengthBytes )
+{
+    size_t xNextHead = pxStreamBuffer->xHead;
+
+    if( xDataLengthBytes != ( size_t ) 0 )
+    {
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* The message itself is already in place, so only the length
+             * remains to be written in front of it. */
+            configASSERT( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+            xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+        }
+        else
+        {
+            configASSERT( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= xDataLengthBytes );
+        }
+
+        /* The bytes were reserved from a single contiguous region. */
+        configASSERT( ( xNextHead + xDataLengthBytes ) <= pxStreamBuffer->xLength );
+        xNextHead += xDataLengthBytes;
+
+        if( xNextHead == pxStreamBuffer->xLength )
+        {
+            xNextHead = ( size_t ) 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The caller's writes to the storage area must complete before the
+         * head makes them visible to the reader. */
+        prvINDEX_MEMORY_BARRIER();
+        pxStreamBuffer->xHead = xNextHead;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
 size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
                              void * pvRxData,
                              size_t xBufferLengthBytes,
@@ -774,6 +1231,21 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         xBytesToStoreMessageLength = 0;
     }
 
+    #if ( configUSE_STREAM_BUFFER_FAST_PATH == 1 )
+    {
+        /* Only the reader moves the tail, so if data is already available
+         * there is no need to enter a critical section to check again. */
+        if( prvBytesInBuffer( pxStreamBuffer ) > xBytesToStoreMessageLength )
+        {
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_STREAM_BUFFER_FAST_PATH */
+
     if( xTicksToWait != ( TickType_t ) 0 )
     {
         /* Checking if there is data and clearing the notification state must be
@@ -795,6 +1267,25 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
                 /* Should only be one reader. */
                 configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
                 pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+
+                #if ( configUSE_STREAM_BUFFER_FAST_PATH == 1 )
+                {
+                    /* The writer does not enter a critical section, so it may
+                     * have written data before it could see this task waiting.
+                     * Check again after the barrier. */
+                    sbFULL_MEMORY_BARRIER();
+                    xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+                    if( xBytesAvailable > xBytesToStoreMessageLength )
+                    {
+                        pxStreamBuffer->xTaskWaitingToReceive = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_STREAM_BUFFER_FAST_PATH */
             }
             else
             {
@@ -836,7 +1327,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         if( xReceivedLength != ( size_t ) 0 )
         {
             traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
-            sbRECEIVE_COMPLETED( pxStreamBuffer );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
         }
         else
         {
@@ -856,7 +1347,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
 size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReturn, xBytesAvailable, xOriginalTail;
+    size_t xReturn, xBytesAvailable;
     configMESSAGE_BUFFER_LENGTH_TYPE xTempReturn;
 
     configASSERT( pxStreamBuffer );
@@ -871,13 +1362,9 @@ size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
             /* The number of bytes available is greater than the number of bytes
              * required to hold the length of the next message, so another message
              * is available.  Return its length without removing the length bytes
-             * from the buffer.  A copy of the tail is stored so the buffer can be
-             * returned to its prior state as the message is not actually being
-             * removed from the buffer. */
-            xOriginalTail = pxStreamBuffer->xTail;
-            ( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, xBytesAvailable );
+             * from the buffer - the tail is not updated. */
+            ( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
             xReturn = ( size_t ) xTempReturn;
-            pxStreamBuffer->xTail = xOriginalTail;
         }
         else
         {
@@ -937,7 +1424,7 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
         {
-            sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
         else
         {
@@ -961,17 +1448,22 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                         size_t xBytesAvailable,
                                         size_t xBytesToStoreMessageLength )
 {
-    size_t xOriginalTail, xReceivedLength, xNextMessageLength;
+    size_t xNextTail, xReceivedLength, xNextMessageLength;
     configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 
+    xNextTail = pxStreamBuffer->xTail;
+
+    /* xBytesAvailable was calculated from the head, which must be read before
+     * the storage area is read. */
+    prvINDEX_MEMORY_BARRIER();
+
     if( xBytesToStoreMessageLength != ( size_t ) 0 )
     {
         /* A discrete message is being received.  First receive the length
-         * of the message.  A copy of the tail is stored so the buffer can be
-         * returned to its prior state if the length of the message is too
-         * large for the provided buffer. */
-        xOriginalTail = pxStreamBuffer->xTail;
-        ( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, xBytesToStoreMessageLength, xBytesAvailable );
+         * of the message.  The tail is not updated until the message itself
+         * has been read, so the length remains in the buffer if the message
+         * is too large for the provided buffer. */
+        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, xBytesToStoreMessageLength, xNextTail );
         xNextMessageLength = ( size_t ) xTempNextMessageLength;
 
         /* Reduce the number of bytes available by the number of bytes just
@@ -983,9 +1475,8 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
         if( xNextMessageLength > xBufferLengthBytes )
         {
             /* The user has provided insufficient space to read the message
-             * so return the buffer to its previous state (so the length of
-             * the message is in the buffer again). */
-            pxStreamBuffer->xTail = xOriginalTail;
+             * so leave the buffer in its previous state (so the length of
+             * the message is still in the buffer). */
             xNextMessageLength = 0;
         }
         else
@@ -1000,13 +1491,181 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
         xNextMessageLength = xBufferLengthBytes;
     }
 
-    /* Read the actual data. */
-    xReceivedLength = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xNextMessageLength, xBytesAvailable ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+    /* Use the minimum of the wanted bytes and the available bytes. */
+    xReceivedLength = configMIN( xBytesAvailable, xNextMessageLength );
+
+    if( xReceivedLength != ( size_t ) 0 )
+    {
+        /* Read the actual data and then update the tail to remove both the
+         * data and its length, if any, from the buffer. */
+        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xReceivedLength, xNextTail ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+        prvINDEX_MEMORY_BARRIER();
+        pxStreamBuffer->xTail = xNextTail;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
     return xReceivedLength;
 }
 /*-----------------------------------------------------------*/
 
+size_t xStreamBufferPeekContiguous( StreamBufferHandle_t xStreamBuffer,
+                                    void ** ppvData )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn, xBytesAvailable, xStart;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+    configASSERT( ppvData );
+    configASSERT( pxStreamBuffer );
+
+    xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+    xStart = pxStreamBuffer->xTail;
+
+    /* xBytesAvailable was calculated from the head, which must be read before
+     * the storage area is read. */
+    prvINDEX_MEMORY_BARRIER();
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+    {
+        /* This is a stream buffer, so return as many bytes as possible without
+         * wrapping past the end of the storage area. */
+        xReturn = configMIN( xBytesAvailable, pxStreamBuffer->xLength - xStart );
+    }
+    else if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+    {
+        /* This is a message buffer, so return the whole of the next message,
+         * but only if it was not split across the end of the storage area. */
+        xStart = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xStart );
+        xReturn = ( size_t ) xTempNextMessageLength;
+
+        if( xReturn > ( pxStreamBuffer->xLength - xStart ) )
+        {
+            xReturn = 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        xReturn = 0;
+    }
+
+    if( xReturn != ( size_t ) 0 )
+    {
+        *ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ xStart ] );
+    }
+    else
+    {
+        *ppvData = NULL;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                             size_t xDataLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvConsumeFromBuffer( pxStreamBuffer, xDataLengthBytes );
+
+    /* Was a task waiting for space in the buffer? */
+    if( xReturn != ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+        prvRECEIVE_COMPLETED( pxStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xDataLengthBytes,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvConsumeFromBuffer( pxStreamBuffer, xDataLengthBytes );
+
+    /* Was a task waiting for space in the buffer? */
+    if( xReturn != ( size_t ) 0 )
+    {
+        prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvConsumeFromBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                    size_t xDataLengthBytes )
+{
+    size_t xNextTail = pxStreamBuffer->xTail;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+    if( xDataLengthBytes != ( size_t ) 0 )
+    {
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* A message is always consumed whole, along with its length. */
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+            configASSERT( ( size_t ) xTempNextMessageLength == xDataLengthBytes );
+        }
+        else
+        {
+            configASSERT( prvBytesInBuffer( pxStreamBuffer ) >= xDataLengthBytes );
+        }
+
+        /* The bytes were peeked from a single contiguous region. */
+        configASSERT( ( xNextTail + xDataLengthBytes ) <= pxStreamBuffer->xLength );
+        xNextTail += xDataLengthBytes;
+
+        if( xNextTail == pxStreamBuffer->xLength )
+        {
+            xNextTail = ( size_t ) 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The caller's reads from the storage area must complete before the
+         * tail releases the space to the writer. */
+        prvINDEX_MEMORY_BARRIER();
+        pxStreamBuffer->xTail = xNextTail;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
 {
     const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
@@ -1130,14 +1789,14 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
 
 static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
                                      const uint8_t * pucData,
-                                     size_t xCount )
+                                     size_t xCount,
+                                     size_t xHead )
 {
-    size_t xNextHead, xFirstLength;
+    size_t xNextHead = xHead;
+    size_t xFirstLength;
 
     configASSERT( xCount > ( size_t ) 0 );
 
-    xNextHead = pxStreamBuffer->xHead;
-
     /* Calculate the number of bytes that can be added in the first write -
      * which may be less than the total number of bytes that need to be added if
      * the buffer will wrap back to the beginning. */
@@ -1171,67 +1830,56 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    pxStreamBuffer->xHead = xNextHead;
-
-    return xCount;
+    return xNextHead;
 }
 /*-----------------------------------------------------------*/
 
 static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       uint8_t * pucData,
-                                      size_t xMaxCount,
-                                      size_t xBytesAvailable )
+                                      size_t xCount,
+                                      size_t xTail )
 {
-    size_t xCount, xFirstLength, xNextTail;
-
-    /* Use the minimum of the wanted bytes and the available bytes. */
-    xCount = configMIN( xBytesAvailable, xMaxCount );
-
-    if( xCount > ( size_t ) 0 )
-    {
-        xNextTail = pxStreamBuffer->xTail;
+    size_t xNextTail = xTail;
+    size_t xFirstLength;
 
-        /* Calculate the number of bytes that can be read - which may be
-         * less than the number wanted if the data wraps around to the start of
-         * the buffer. */
-        xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+    configASSERT( xCount > ( size_t ) 0 );
 
-        /* Obtain the number of bytes it is possible to obtain in the first
-         * read.  Asserts check bounds of read and write. */
-        configASSERT( xFirstLength <= xMaxCount );
-        configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
-        ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+    /* Calculate the number of bytes that can be read - which may be
+     * less than the number wanted if the data wraps around to the start of
+     * the buffer. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
 
-        /* If the total number of wanted bytes is greater than the number
-         * that could be read in the first read... */
-        if( xCount > xFirstLength )
-        {
-            /*...then read the remaining bytes from the start of the buffer. */
-            configASSERT( xCount <= xMaxCount );
-            ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+    /* Obtain the number of bytes it is possible to obtain in the first
+     * read.  Asserts check bounds of read and write. */
+    configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
+    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 
-        /* Move the tail pointer to effectively remove the data read from
-         * the buffer. */
-        xNextTail += xCount;
+    /* If the total number of wanted bytes is greater than the number
+     * that could be read in the first read... */
+    if( xCount > xFirstLength )
+    {
+        /*...then read the remaining bytes from the start of the buffer. */
+        configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
+        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-        if( xNextTail >= pxStreamBuffer->xLength )
-        {
-            xNextTail -= pxStreamBuffer->xLength;
-        }
+    /* Move the tail index past the data read. */
+    xNextTail += xCount;
 
-        pxStreamBuffer->xTail = xNextTail;
+    if( xNextTail >= pxStreamBuffer->xLength )
+    {
+        xNextTail -= pxStreamBuffer->xLength;
     }
     else
     {
         mtCOVERAGE_TEST_MARKER();
     }
 
-    return xCount;
+    return xNextTail;
 }
 /*-----------------------------------------------------------*/
 
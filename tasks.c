@@ -99,6 +99,18 @@
 #define tskDELETED_CHAR      ( 'D' )
 #define tskSUSPENDED_CHAR    ( 'S' )
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* Value held in the xTaskRunState member of the TCB of a task that is not
+ * running on any core.  A running task holds the ID of the core it is running
+ * on instead. */
+    #define taskTASK_NOT_RUNNING    ( ( BaseType_t ) -1 )
+
+    #define taskTASK_IS_RUNNING( pxTCB )    ( ( pxTCB )->xTaskRunState != taskTASK_NOT_RUNNING )
+#else
+    #define taskTASK_IS_RUNNING( pxTCB )    ( ( pxTCB ) == pxCurrentTCB )
+#endif
+
 /*
  * Some kernel aware debuggers require the data the debugger needs access to be
  * global, rather than file scope.
@@ -113,7 +125,7 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
-#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 0 ) )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
  * performed in a generic way that is not optimised to any particular
@@ -156,6 +168,82 @@
     #define taskRESET_READY_PRIORITY( uxPriority )
     #define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )
 
+#elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+
+/* If configUSE_PRIORITY_BITMAP_TASK_SELECTION is 1 then task selection is
+ * still performed in a generic way, but a two level bitmap of the priorities
+ * that contain ready tasks is maintained so the highest priority ready task
+ * can be found in constant time, however many priorities are configured.  Bit
+ * n of ulReadyPriorityBitmap[ w ] is set when priority ( ( w * 32 ) + n ) has
+ * ready tasks, and bit w of ulReadyPriorityGroups is set when any bit of
+ * ulReadyPriorityBitmap[ w ] is set. */
+    #if ( configMAX_PRIORITIES > 1024 )
+        #error configMAX_PRIORITIES cannot be greater than 1024 when configUSE_PRIORITY_BITMAP_TASK_SELECTION is 1
+    #endif
+
+    #define taskPRIORITY_BITMAP_WORDS    ( ( configMAX_PRIORITIES + 31 ) / 32 )
+
+/* taskHIGHEST_SET_BIT() returns the number of the most significant set bit in
+ * a non-zero 32-bit value.  The compiler's count leading zeros builtin is used
+ * where one is known to exist, otherwise a small lookup table is used. */
+    #if defined( __GNUC__ )
+        #define taskHIGHEST_SET_BIT( ulBits )    ( ( UBaseType_t ) ( ( sizeof( unsigned long ) * 8U ) - 1U ) - ( UBaseType_t ) __builtin_clzl( ( unsigned long ) ( ulBits ) ) )
+    #else
+        #define taskHIGHEST_SET_BIT( ulBits )    prvHighestSetBit( ulBits )
+    #endif
+
+/* uxTopReadyPriority is only maintained as an upper bound of the highest
+ * priority ready task so the idle time calculation, and kernel aware debuggers,
+ * can use it in the same way as when the bitmap is not used. */
+    #define taskRECORD_READY_PRIORITY( uxPriority )                                                         \
+    {                                                                                                       \
+        ulReadyPriorityBitmap[ ( uxPriority ) >> 5U ] |= ( uint32_t ) 1UL << ( ( uxPriority ) & 31U );      \
+        ulReadyPriorityGroups |= ( uint32_t ) 1UL << ( ( uxPriority ) >> 5U );                              \
+                                                                                                            \
+        if( ( uxPriority ) > uxTopReadyPriority )                                                           \
+        {                                                                                                   \
+            uxTopReadyPriority = ( uxPriority );                                                            \
+        }                                                                                                   \
+    } /* taskRECORD_READY_PRIORITY */
+
+/*-----------------------------------------------------------*/
+
+    #define taskSELECT_HIGHEST_PRIORITY_TASK()                                                                   \
+    {                                                                                                            \
+        UBaseType_t uxTopGroup, uxTopPriority;                                                                   \
+                                                                                                                 \
+        /* Find the highest priority list that contains ready tasks. */                                          \
+        configASSERT( ulReadyPriorityGroups != 0UL );                                                            \
+        uxTopGroup = taskHIGHEST_SET_BIT( ulReadyPriorityGroups );                                               \
+        uxTopPriority = ( uxTopGroup << 5U ) + taskHIGHEST_SET_BIT( ulReadyPriorityBitmap[ uxTopGroup ] );       \
+        configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );                  \
+        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );                    \
+        uxTopReadyPriority = uxTopPriority;                                                                      \
+    } /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+
+/*-----------------------------------------------------------*/
+
+/* The bitmap must be kept exact, so clear the bit for a priority when its
+ * ready list becomes empty.  The word's bit in ulReadyPriorityGroups is cleared
+ * when the last bit in the word is cleared. */
+    #define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )                                     \
+    {                                                                                                      \
+        ulReadyPriorityBitmap[ ( uxPriority ) >> 5U ] &= ~( ( uint32_t ) 1UL << ( ( uxPriority ) & 31U ) ); \
+                                                                                                           \
+        if( ulReadyPriorityBitmap[ ( uxPriority ) >> 5U ] == 0UL )                                         \
+        {                                                                                                  \
+            ulReadyPriorityGroups &= ~( ( uint32_t ) 1UL << ( ( uxPriority ) >> 5U ) );                    \
+        }                                                                                                  \
+    }
+
+    #define taskRESET_READY_PRIORITY( uxPriority )                                                     \
+    {                                                                                                  \
+        if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == ( UBaseType_t ) 0 ) \
+        {                                                                                              \
+            portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );                        \
+        }                                                                                              \
+    }
+
 #else /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 1 then task selection is
@@ -194,18 +282,55 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+
+/* A delayed list keeps its tasks in buckets.  Bucket 0 holds the tasks that
+ * wake at xBaseTime, and bucket n the tasks whose wake time differs from
+ * xBaseTime first in bit ( n - 1 ), so every wake time in a bucket is earlier
+ * than every wake time in the buckets above it.  Tasks are added to the end of
+ * their bucket, so the buckets are not sorted.  xBaseTime only moves forward,
+ * and never past the tick count, so no task can wake before it.  When it moves
+ * to the earliest wake time the tasks in that time's bucket are spread over the
+ * buckets below, so a task is moved at most once per bit of TickType_t. */
+    #define taskDELAYED_LIST_BUCKETS    ( ( sizeof( TickType_t ) * ( size_t ) 8 ) + ( size_t ) 1 )
+
+    typedef struct xDELAYED_LIST
+    {
+        TickType_t xBaseTime;
+        List_t xBuckets[ taskDELAYED_LIST_BUCKETS ];
+    } DelayedList_t;
+
+    #define taskDELAYED_LIST_IS_EMPTY( pxList )                         prvDelayedListIsEmpty( pxList )
+    #define taskDELAYED_LIST_INSERT( pxList, pxItem )                   prvDelayedListInsert( ( pxList ), ( pxItem ) )
+    #define taskLIST_IS_WITHIN_DELAYED_LIST( pxList, pxDelayedList )    prvListIsWithinDelayedList( ( pxList ), ( pxDelayedList ) )
+
+/* The overflow delayed list starts again from a tick count of 0. */
+    #define taskRESET_DELAYED_LIST_BASE_TIME( pxList )    ( ( pxList )->xBaseTime = ( TickType_t ) 0U )
+
+#else /* if ( configUSE_RADIX_DELAYED_LISTS == 1 ) */
+
+    typedef List_t DelayedList_t;
+
+    #define taskDELAYED_LIST_IS_EMPTY( pxList )                         listLIST_IS_EMPTY( pxList )
+    #define taskDELAYED_LIST_INSERT( pxList, pxItem )                   vListInsert( ( pxList ), ( pxItem ) )
+    #define taskLIST_IS_WITHIN_DELAYED_LIST( pxList, pxDelayedList )    ( ( pxList ) == ( pxDelayedList ) )
+    #define taskRESET_DELAYED_LIST_BASE_TIME( pxList )
+
+#endif /* configUSE_RADIX_DELAYED_LISTS */
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
  * count overflows. */
 #define taskSWITCH_DELAYED_LISTS()                                                \
     {                                                                             \
-        List_t * pxTemp;                                                          \
+        DelayedList_t * pxTemp;                                                   \
                                                                                   \
         /* The delayed tasks list should be empty when the lists are switched. */ \
-        configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );               \
+        configASSERT( ( taskDELAYED_LIST_IS_EMPTY( pxDelayedTaskList ) ) );       \
                                                                                   \
         pxTemp = pxDelayedTaskList;                                               \
         pxDelayedTaskList = pxOverflowDelayedTaskList;                            \
         pxOverflowDelayedTaskList = pxTemp;                                       \
+        taskRESET_DELAYED_LIST_BASE_TIME( pxOverflowDelayedTaskList );            \
         xNumOfOverflows++;                                                        \
         prvResetNextTaskUnblockTime();                                            \
     }
@@ -216,11 +341,23 @@
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )                                                                 \
+#if ( configNUMBER_OF_CORES == 1 )
+    #define prvAddTaskToReadyList( pxTCB )                                                                 \
     traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
     taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
     vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#else
+
+/* When there is more than one core a task entering the Ready state might have
+ * to preempt a task running on a core other than the calling core. */
+    #define prvAddTaskToReadyList( pxTCB )                                                                 \
+    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
+    taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
+    vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+    tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
+    prvYieldForTask( pxTCB )
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -327,6 +464,14 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        volatile BaseType_t xTaskRunState; /*< The ID of the core the task is running on, or taskTASK_NOT_RUNNING. */
+    #endif
+
+    #if ( configEVENT_GROUP_64BIT == 1 )
+        uint64_t ullEventItemValue; /*< Used by event groups in place of the event list item value, which is too narrow to hold 64 bit event bits. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -335,17 +480,25 @@ typedef tskTCB TCB_t;
 
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
-PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#if ( configNUMBER_OF_CORES == 1 )
+    PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#else
+
+/* Each core has its own current TCB.  pxCurrentTCB is the task running on the
+ * calling core and cannot be assigned to. */
+    PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUMBER_OF_CORES ] = { NULL };
+    #define pxCurrentTCB    xTaskGetCurrentTaskHandle()
+#endif
 
 /* Lists for ready and blocked tasks. --------------------
  * xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
  * doing so breaks some kernel aware debuggers and debuggers that rely on removing
  * the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+PRIVILEGED_DATA static DelayedList_t xDelayedTaskList1;                  /*< Delayed tasks. */
+PRIVILEGED_DATA static DelayedList_t xDelayedTaskList2;                  /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+PRIVILEGED_DATA static DelayedList_t * volatile pxDelayedTaskList;       /*< Points to the delayed task list currently being used. */
+PRIVILEGED_DATA static DelayedList_t * volatile pxOverflowDelayedTaskList; /*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -373,12 +526,38 @@ PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINI
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
-PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
+#if ( configNUMBER_OF_CORES == 1 )
+    PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
+#else
+
+/* Yields are held pending per core.  xYieldPending is only accessed with
+ * interrupts disabled so the calling core cannot change. */
+    PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ] = { pdFALSE };
+    #define xYieldPending    xYieldPendings[ portGET_CORE_ID() ]
+
+/* Set when another core has been asked to yield, and cleared when that core
+ * next selects a task, so a core is only interrupted once however many tasks
+ * become ready for it. */
+    PRIVILEGED_DATA static volatile BaseType_t xYieldRequests[ configNUMBER_OF_CORES ] = { pdFALSE };
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
+
+#if ( configTICK_MAX_UNBLOCKS > 0 )
+    PRIVILEGED_DATA static volatile UBaseType_t uxDeferredUnblocks = ( UBaseType_t ) 0U; /*< The number of tasks that were unblocked after the tick interrupt of the tick on which they were due. */
+#endif
 PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL;                          /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
 
+#if ( configNUMBER_OF_CORES > 1 )
+    PRIVILEGED_DATA static TaskHandle_t xPassiveIdleTaskHandles[ configNUMBER_OF_CORES - 1 ]; /*< Holds the handles of the additional idle tasks that ensure every core always has a task to run. */
+#endif
+
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 ) )
+    PRIVILEGED_DATA static uint32_t ulReadyPriorityGroups = 0UL;                                 /*< One bit per word of ulReadyPriorityBitmap that has any bit set. */
+    PRIVILEGED_DATA static uint32_t ulReadyPriorityBitmap[ taskPRIORITY_BITMAP_WORDS ] = { 0UL }; /*< One bit per priority that has ready tasks. */
+#endif
+
 /* Improve support for OpenOCD. The kernel tracks Ready tasks via priority lists.
  * For tracking the state of remote threads, OpenOCD uses uxTopUsedPriority
  * to determine the number of priority lists to read back from the remote target. */
@@ -439,6 +618,37 @@ static void prvInitialiseTaskLists( void ) PRIVILEGED_FUNCTION;
  */
 static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/*
+ * The additional idle tasks created when there is more than one core.  They
+ * ensure each core always has a task to run, but leave freeing deleted tasks
+ * and calling the idle hook to prvIdleTask().
+ */
+    static portTASK_FUNCTION_PROTO( prvPassiveIdleTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets pxCurrentTCBs[ xCoreID ] to the highest priority ready task that is not
+ * already running on another core.
+ */
+    static void prvSelectHighestPriorityTask( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+/*
+ * Requests a context switch on the core xCoreID.  Must be called from a
+ * critical section.
+ */
+    static void prvYieldCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when pxTCB enters the Ready state.  If the calling core will not run
+ * pxTCB itself then the core running the lowest priority task is asked to
+ * yield if pxTCB has a higher priority.  Must be called from a critical
+ * section.
+ */
+    static void prvYieldForTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES */
+
 /*
  * Utility to free all memory allocated by the scheduler to hold a TCB,
  * including the stack pointed to by the TCB.
@@ -525,6 +735,48 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Move the tasks whose wake time is not after xTime from the delayed list to
+ * the ready lists, and update xNextTaskUnblockTime.  If configTICK_MAX_UNBLOCKS
+ * is not 0 then no more than that many tasks are moved, and xNextTaskUnblockTime
+ * is left at xTime if any due tasks remain.  xFromTickInterrupt is pdTRUE when
+ * called for the tick that has just occurred.  Returns pdTRUE if a task that was
+ * moved should preempt the calling task.
+ */
+static BaseType_t prvUnblockDelayedTasks( const TickType_t xTime,
+                                          const BaseType_t xFromTickInterrupt ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of the most significant set bit in ulBits, which must not
+ * be zero.  Only used by the priority bitmap task selection when the compiler
+ * does not provide a count leading zeros builtin.
+ */
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 ) && !defined( __GNUC__ ) )
+
+    static UBaseType_t prvHighestSetBit( uint32_t ulBits ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+
+/*
+ * Functions that manage the bucketed delayed lists.  prvDelayedListGetNextTime()
+ * returns the earliest wake time in the list, or portMAX_DELAY if the list is
+ * empty.  prvDelayedListCollectDue() does the same, but first moves the tasks
+ * that wake at that time into bucket 0 if the time is not after xTime.
+ */
+    static void prvDelayedListInitialise( DelayedList_t * const pxDelayedList ) PRIVILEGED_FUNCTION;
+    static void prvDelayedListInsert( DelayedList_t * const pxDelayedList,
+                                      ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvDelayedListIsEmpty( const DelayedList_t * const pxDelayedList ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvListIsWithinDelayedList( const List_t * const pxList,
+                                                  const DelayedList_t * const pxDelayedList ) PRIVILEGED_FUNCTION;
+    static TickType_t prvDelayedListGetNextTime( const DelayedList_t * const pxDelayedList ) PRIVILEGED_FUNCTION;
+    static TickType_t prvDelayedListCollectDue( DelayedList_t * const pxDelayedList,
+                                                const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 /*
@@ -1000,6 +1252,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        {
+            pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+        }
+    #endif
+
     /* Initialize the TCB stack to look as if the task was already running,
      * but had been interrupted by the scheduler.  The return address is set
      * to the start of the task function. Once the stack has been initialised
@@ -1073,45 +1331,63 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         uxCurrentNumberOfTasks++;
 
-        if( pxCurrentTCB == NULL )
-        {
-            /* There are no other tasks, or all the other tasks are in
-             * the suspended state - make this the current task. */
-            pxCurrentTCB = pxNewTCB;
-
-            if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-            {
-                /* This is the first task to be created so do the preliminary
-                 * initialisation required.  We will not recover if this call
-                 * fails, but we will report the failure. */
-                prvInitialiseTaskLists();
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        }
-        else
-        {
-            /* If the scheduler is not already running, make this task the
-             * current task if it is the highest priority task to be created
-             * so far. */
-            if( xSchedulerRunning == pdFALSE )
+        #if ( configNUMBER_OF_CORES == 1 )
             {
-                if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+                if( pxCurrentTCB == NULL )
                 {
+                    /* There are no other tasks, or all the other tasks are in
+                     * the suspended state - make this the current task. */
                     pxCurrentTCB = pxNewTCB;
+
+                    if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+                    {
+                        /* This is the first task to be created so do the preliminary
+                         * initialisation required.  We will not recover if this call
+                         * fails, but we will report the failure. */
+                        prvInitialiseTaskLists();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* If the scheduler is not already running, make this task the
+                     * current task if it is the highest priority task to be created
+                     * so far. */
+                    if( xSchedulerRunning == pdFALSE )
+                    {
+                        if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+                        {
+                            pxCurrentTCB = pxNewTCB;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
             }
-            else
+        #else /* if ( configNUMBER_OF_CORES == 1 ) */
             {
-                mtCOVERAGE_TEST_MARKER();
+                /* Each core is given its first task when the scheduler is
+                 * started.  Tasks created after that are scheduled by the
+                 * prvYieldForTask() call within prvAddTaskToReadyList(). */
+                if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+                {
+                    prvInitialiseTaskLists();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-        }
+        #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
         uxTaskNumber++;
 
@@ -1187,10 +1463,11 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * not return. */
             uxTaskNumber++;
 
-            if( pxTCB == pxCurrentTCB )
+            if( taskTASK_IS_RUNNING( pxTCB ) )
             {
-                /* A task is deleting itself.  This cannot complete within the
-                 * task itself, as a context switch to another task is required.
+                /* A task is deleting itself, or a task running on another core
+                 * is being deleted.  This cannot complete within the task
+                 * itself, as a context switch to another task is required.
                  * Place the task in the termination list.  The idle task will
                  * check the termination list and free up any memory allocated by
                  * the scheduler for the TCB and stack of the deleted task. */
@@ -1211,6 +1488,21 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * hence xYieldPending is used to latch that a context switch is
                  * required. */
                 portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+
+                #if ( configNUMBER_OF_CORES > 1 )
+                    {
+                        /* The idle task will not free the TCB until the core
+                         * running the deleted task has switched away from it. */
+                        if( pxTCB != pxCurrentTCB )
+                        {
+                            prvYieldCore( pxTCB->xTaskRunState );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
             }
             else
             {
@@ -1381,14 +1673,16 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     eTaskState eTaskGetState( TaskHandle_t xTask )
     {
         eTaskState eReturn;
-        List_t const * pxStateList, * pxDelayedList, * pxOverflowedDelayedList;
+        List_t const * pxStateList;
+        DelayedList_t const * pxDelayedList, * pxOverflowedDelayedList;
         const TCB_t * const pxTCB = xTask;
 
         configASSERT( pxTCB );
 
-        if( pxTCB == pxCurrentTCB )
+        if( taskTASK_IS_RUNNING( pxTCB ) )
         {
-            /* The task calling this function is querying its own state. */
+            /* The task calling this function is querying its own state, or
+             * the state of a task running on another core. */
             eReturn = eRunning;
         }
         else
@@ -1401,7 +1695,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             }
             taskEXIT_CRITICAL();
 
-            if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            if( ( taskLIST_IS_WITHIN_DELAYED_LIST( pxStateList, pxDelayedList ) != pdFALSE ) || ( taskLIST_IS_WITHIN_DELAYED_LIST( pxStateList, pxOverflowedDelayedList ) != pdFALSE ) )
             {
                 /* The task being queried is referenced from one of the Blocked
                  * lists. */
@@ -1613,6 +1907,20 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     /* Setting the priority of any other task down does not
                      * require a yield as the running task must be above the
                      * new priority of the task being modified. */
+                    #if ( configNUMBER_OF_CORES > 1 )
+                        {
+                            /* Unless the task is running on another core, which
+                             * may now have a higher priority task to run. */
+                            if( taskTASK_IS_RUNNING( pxTCB ) )
+                            {
+                                prvYieldCore( pxTCB->xTaskRunState );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #endif
                 }
 
                 /* Remember the ready list the task might be referenced from
@@ -1753,6 +2061,21 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     }
                 }
             #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+
+            #if ( configNUMBER_OF_CORES > 1 )
+                {
+                    /* A task running on another core has to be switched out
+                     * by that core. */
+                    if( ( taskTASK_IS_RUNNING( pxTCB ) ) && ( pxTCB != pxCurrentTCB ) )
+                    {
+                        prvYieldCore( pxTCB->xTaskRunState );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
         }
         taskEXIT_CRITICAL();
 
@@ -1783,19 +2106,25 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             {
                 /* The scheduler is not running, but the task that was pointed
                  * to by pxCurrentTCB has just been suspended and pxCurrentTCB
-                 * must be adjusted to point to a different task. */
-                if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
-                {
-                    /* No other tasks are ready, so set pxCurrentTCB back to
-                     * NULL so when the next task is created pxCurrentTCB will
-                     * be set to point to it no matter what its relative priority
-                     * is. */
-                    pxCurrentTCB = NULL;
-                }
-                else
-                {
-                    vTaskSwitchContext();
-                }
+                 * must be adjusted to point to a different task.  When there
+                 * is more than one core pxCurrentTCB is not set until the
+                 * scheduler is started, so this cannot happen. */
+                #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+                        {
+                            /* No other tasks are ready, so set pxCurrentTCB back to
+                             * NULL so when the next task is created pxCurrentTCB will
+                             * be set to point to it no matter what its relative priority
+                             * is. */
+                            pxCurrentTCB = NULL;
+                        }
+                        else
+                        {
+                            vTaskSwitchContext();
+                        }
+                    }
+                #endif /* configNUMBER_OF_CORES */
             }
         }
         else
@@ -2027,6 +2356,71 @@ void vTaskStartScheduler( void )
         }
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        {
+            BaseType_t xCoreID;
+            char cIdleName[ configMAX_TASK_NAME_LEN ];
+            UBaseType_t x;
+
+            /* Every additional core needs its own idle task so it always has
+             * something to run.  These passive idle tasks do not perform any
+             * of the idle task housekeeping, which is left to the idle task
+             * created above.  Their names are the idle task name followed by
+             * the index of the passive idle task. */
+            for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) ( configMAX_TASK_NAME_LEN - 2 ); x++ )
+            {
+                cIdleName[ x ] = configIDLE_TASK_NAME[ x ];
+
+                if( cIdleName[ x ] == ( char ) 0x00 )
+                {
+                    break;
+                }
+            }
+
+            cIdleName[ x + ( UBaseType_t ) 1 ] = ( char ) 0x00;
+
+            for( xCoreID = ( BaseType_t ) 0; ( xCoreID < ( BaseType_t ) ( configNUMBER_OF_CORES - 1 ) ) && ( xReturn == pdPASS ); xCoreID++ )
+            {
+                cIdleName[ x ] = ( char ) ( '0' + xCoreID );
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                    {
+                        StaticTask_t * pxIdleTaskTCBBuffer = NULL;
+                        StackType_t * pxIdleTaskStackBuffer = NULL;
+                        uint32_t ulIdleTaskStackSize;
+
+                        vApplicationGetPassiveIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize, xCoreID );
+                        xPassiveIdleTaskHandles[ xCoreID ] = xTaskCreateStatic( prvPassiveIdleTask,
+                                                                                cIdleName,
+                                                                                ulIdleTaskStackSize,
+                                                                                ( void * ) NULL,
+                                                                                portPRIVILEGE_BIT,
+                                                                                pxIdleTaskStackBuffer,
+                                                                                pxIdleTaskTCBBuffer );
+
+                        if( xPassiveIdleTaskHandles[ xCoreID ] != NULL )
+                        {
+                            xReturn = pdPASS;
+                        }
+                        else
+                        {
+                            xReturn = pdFAIL;
+                        }
+                    }
+                #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+                    {
+                        xReturn = xTaskCreate( prvPassiveIdleTask,
+                                               cIdleName,
+                                               configMINIMAL_STACK_SIZE,
+                                               ( void * ) NULL,
+                                               portPRIVILEGE_BIT,
+                                               &( xPassiveIdleTaskHandles[ xCoreID ] ) );
+                    }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+            }
+        }
+    #endif /* configNUMBER_OF_CORES */
+
     #if ( configUSE_TIMERS == 1 )
         {
             if( xReturn == pdPASS )
@@ -2072,6 +2466,19 @@ void vTaskStartScheduler( void )
         xSchedulerRunning = pdTRUE;
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                BaseType_t xCoreID;
+
+                /* Select the task each core will start by running.  There are
+                 * at least as many idle tasks as cores so every core gets one. */
+                for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    prvSelectHighestPriorityTask( xCoreID );
+                }
+            }
+        #endif /* configNUMBER_OF_CORES */
+
         /* If configGENERATE_RUN_TIME_STATS is defined then the following
          * macro must be defined to configure the timer/counter used to generate
          * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
@@ -2130,17 +2537,40 @@ void vTaskSuspendAll( void )
      * post in the FreeRTOS support forum before reporting this as a bug! -
      * https://goo.gl/wu4acr */
 
-    /* portSOFRWARE_BARRIER() is only implemented for emulated/simulated ports that
-     * do not otherwise exhibit real time behaviour. */
-    portSOFTWARE_BARRIER();
+    #if ( configNUMBER_OF_CORES == 1 )
+        {
+            /* portSOFRWARE_BARRIER() is only implemented for emulated/simulated ports that
+             * do not otherwise exhibit real time behaviour. */
+            portSOFTWARE_BARRIER();
+
+            /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
+             * is used to allow calls to vTaskSuspendAll() to nest. */
+            ++uxSchedulerSuspended;
+
+            /* Enforces ordering for ports and optimised compilers that may otherwise place
+             * the above increment elsewhere. */
+            portMEMORY_BARRIER();
+        }
+    #else /* if ( configNUMBER_OF_CORES == 1 ) */
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            /* The task lock is held until the scheduler is resumed, which stops
+             * the other cores switching context or entering critical sections.
+             * The ISR lock is only held while the count is incremented so
+             * interrupts on the other cores see a consistent value. */
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+            {
+                portGET_TASK_LOCK();
+                portGET_ISR_LOCK();
 
-    /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
-     * is used to allow calls to vTaskSuspendAll() to nest. */
-    ++uxSchedulerSuspended;
+                ++uxSchedulerSuspended;
 
-    /* Enforces ordering for ports and optimised compilers that may otherwise place
-     * the above increment elsewhere. */
-    portMEMORY_BARRIER();
+                portRELEASE_ISR_LOCK();
+            }
+            portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+        }
+    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 }
 /*----------------------------------------------------------*/
 
@@ -2199,6 +2629,24 @@ void vTaskSuspendAll( void )
         else
         {
             xReturn = xNextTaskUnblockTime - xTickCount;
+
+            #if ( configUSE_FAST_TIMERS == 1 )
+                {
+                    /* Fast timers are processed by the tick interrupt, so the
+                     * tick must not be suppressed beyond the next fast timer
+                     * expiry. */
+                    const TickType_t xTicksToFastTimer = xTimerGetNextFastExpireTime() - xTickCount;
+
+                    if( xTicksToFastTimer < xReturn )
+                    {
+                        xReturn = xTicksToFastTimer;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* configUSE_FAST_TIMERS */
         }
 
         return xReturn;
@@ -2225,6 +2673,14 @@ BaseType_t xTaskResumeAll( void )
     {
         --uxSchedulerSuspended;
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                /* Release the task lock taken by vTaskSuspendAll().  It is
+                 * still held by the critical section. */
+                portRELEASE_TASK_LOCK();
+            }
+        #endif
+
         if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
         {
             if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
@@ -2372,6 +2828,18 @@ UBaseType_t uxTaskGetNumberOfTasks( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configTICK_MAX_UNBLOCKS > 0 )
+
+    UBaseType_t uxTaskGetDeferredUnblockCount( void )
+    {
+        /* A critical section is not required because the variable is of type
+         * UBaseType_t. */
+        return uxDeferredUnblocks;
+    }
+
+#endif /* configTICK_MAX_UNBLOCKS */
+/*-----------------------------------------------------------*/
+
 char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 {
     TCB_t * pxTCB;
@@ -2479,32 +2947,50 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
             } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
             /* Search the delayed lists. */
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-            }
+            #if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+                {
+                    size_t xBucket;
 
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
-            }
+                    for( xBucket = ( size_t ) 0; ( xBucket < taskDELAYED_LIST_BUCKETS ) && ( pxTCB == NULL ); xBucket++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( pxDelayedTaskList->xBuckets[ xBucket ] ), pcNameToQuery );
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
+                        if( pxTCB == NULL )
+                        {
+                            pxTCB = prvSearchForNameWithinSingleList( &( pxOverflowDelayedTaskList->xBuckets[ xBucket ] ), pcNameToQuery );
+                        }
+                    }
+                }
+            #else /* if ( configUSE_RADIX_DELAYED_LISTS == 1 ) */
                 {
                     if( pxTCB == NULL )
                     {
-                        /* Search the suspended list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
                     }
-                }
-            #endif
 
-            #if ( INCLUDE_vTaskDelete == 1 )
-                {
                     if( pxTCB == NULL )
                     {
-                        /* Search the deleted list. */
-                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif /* configUSE_RADIX_DELAYED_LISTS */
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the suspended list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the deleted list. */
+                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
                     }
                 }
             #endif
@@ -2540,8 +3026,22 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
 
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                #if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+                    {
+                        size_t xBucket;
+
+                        for( xBucket = ( size_t ) 0; xBucket < taskDELAYED_LIST_BUCKETS; xBucket++ )
+                        {
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxDelayedTaskList->xBuckets[ xBucket ] ), eBlocked );
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxOverflowDelayedTaskList->xBuckets[ xBucket ] ), eBlocked );
+                        }
+                    }
+                #else
+                    {
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                    }
+                #endif /* configUSE_RADIX_DELAYED_LISTS */
 
                 #if ( INCLUDE_vTaskDelete == 1 )
                     {
@@ -2602,6 +3102,29 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
         return xIdleTaskHandle;
     }
 
+    #if ( configNUMBER_OF_CORES > 1 )
+
+        TaskHandle_t xTaskGetIdleTaskHandleForCore( BaseType_t xCoreID )
+        {
+            TaskHandle_t xReturn;
+
+            configASSERT( ( xCoreID >= ( BaseType_t ) 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+
+            if( xCoreID == ( BaseType_t ) 0 )
+            {
+                xReturn = xTaskGetIdleTaskHandle();
+            }
+            else
+            {
+                xReturn = xPassiveIdleTaskHandles[ xCoreID - 1 ];
+                configASSERT( ( xReturn != NULL ) );
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configNUMBER_OF_CORES */
+
 #endif /* INCLUDE_xTaskGetIdleTaskHandle */
 /*----------------------------------------------------------*/
 
@@ -2722,122 +3245,235 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
 #endif /* INCLUDE_xTaskAbortDelay */
 /*----------------------------------------------------------*/
 
-BaseType_t xTaskIncrementTick( void )
+static BaseType_t prvUnblockDelayedTasks( const TickType_t xTime,
+                                          const BaseType_t xFromTickInterrupt )
 {
     TCB_t * pxTCB;
     TickType_t xItemValue;
     BaseType_t xSwitchRequired = pdFALSE;
 
-    /* Called by the portable layer each time a tick interrupt occurs.
-     * Increments the tick then checks to see if the new tick value will cause any
-     * tasks to be unblocked. */
-    traceTASK_INCREMENT_TICK( xTickCount );
+    #if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+        /* Only bucket 0 is in wake time order, as all the tasks in it
+         * wake at the same time. */
+        List_t * const pxDueList = &( pxDelayedTaskList->xBuckets[ 0 ] );
+    #else
+        List_t * const pxDueList = pxDelayedTaskList;
+    #endif
 
-    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-    {
-        /* Minor optimisation.  The tick count cannot change in this
-         * block. */
-        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+    #if ( configTICK_MAX_UNBLOCKS > 0 )
+        UBaseType_t uxUnblocked = ( UBaseType_t ) 0U;
+    #else
+        /* Avoid compiler warning when configTICK_MAX_UNBLOCKS is 0. */
+        ( void ) xFromTickInterrupt;
+    #endif
 
-        /* Increment the RTOS tick, switching the delayed and overflowed
-         * delayed lists if it wraps to 0. */
-        xTickCount = xConstTickCount;
+    /* Tasks are stored in the queue in the order of their wake time - meaning
+     * once one task has been found whose block time has not expired there is
+     * no need to look any further down the list. */
+    for( ; ; )
+    {
+        #if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+            {
+                /* Move the tasks that wake next into bucket 0 if
+                 * their wake time has been reached.  If the list is
+                 * empty xNextTaskUnblockTime is set to portMAX_DELAY
+                 * so it is extremely unlikely that the
+                 * if( xTickCount >= xNextTaskUnblockTime ) test will
+                 * pass next time through. */
+                xNextTaskUnblockTime = prvDelayedListCollectDue( pxDelayedTaskList, xTime );
+            }
+        #endif /* configUSE_RADIX_DELAYED_LISTS */
 
-        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        if( listLIST_IS_EMPTY( pxDueList ) != pdFALSE )
         {
-            taskSWITCH_DELAYED_LISTS();
+            #if ( configUSE_RADIX_DELAYED_LISTS == 0 )
+                {
+                    /* The delayed list is empty.  Set
+                     * xNextTaskUnblockTime to the maximum possible value
+                     * so it is extremely unlikely that the
+                     * if( xTickCount >= xNextTaskUnblockTime ) test will
+                     * pass next time through. */
+                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                }
+            #endif
+            break;
         }
         else
         {
-            mtCOVERAGE_TEST_MARKER();
-        }
-
-        /* See if this tick has made a timeout expire.  Tasks are stored in
-         * the  queue in the order of their wake time - meaning once one task
-         * has been found whose block time has not expired there is no need to
-         * look any further down the list. */
-        if( xConstTickCount >= xNextTaskUnblockTime )
-        {
-            for( ; ; )
+            /* The delayed list is not empty, get the value of the
+             * item at the head of the delayed list.  This is the time
+             * at which the task at the head of the delayed list must
+             * be removed from the Blocked state. */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDueList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+            if( xTime < xItemValue )
+            {
+                /* It is not time to unblock this item yet, but the
+                 * item value is the time at which the task at the head
+                 * of the blocked list must be removed from the Blocked
+                 * state -  so record the item value in
+                 * xNextTaskUnblockTime. */
+                xNextTaskUnblockTime = xItemValue;
+                break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
+            }
+            else
             {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-                {
-                    /* The delayed list is empty.  Set xNextTaskUnblockTime
-                     * to the maximum possible value so it is extremely
-                     * unlikely that the
-                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-                     * next time through. */
-                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                    break;
-                }
-                else
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            #if ( configTICK_MAX_UNBLOCKS > 0 )
                 {
-                    /* The delayed list is not empty, get the value of the
-                     * item at the head of the delayed list.  This is the time
-                     * at which the task at the head of the delayed list must
-                     * be removed from the Blocked state. */
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-                    if( xConstTickCount < xItemValue )
+                    if( uxUnblocked == ( UBaseType_t ) configTICK_MAX_UNBLOCKS )
                     {
-                        /* It is not time to unblock this item yet, but the
-                         * item value is the time at which the task at the head
-                         * of the blocked list must be removed from the Blocked
-                         * state -  so record the item value in
-                         * xNextTaskUnblockTime. */
-                        xNextTaskUnblockTime = xItemValue;
-                        break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
+                        /* Leave the remaining tasks for the next context
+                         * switch or tick.  xNextTaskUnblockTime is set to a
+                         * time that has been reached so the next tick tries
+                         * again, and so no tickless idle period is started
+                         * in the meantime. */
+                        xNextTaskUnblockTime = xTime;
+                        break;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-                    /* It is time to remove the item from the Blocked state. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    uxUnblocked++;
 
-                    /* Is the task waiting on an event also?  If so remove
-                     * it from the event list. */
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    /* A task is deferred if it is not unblocked by the tick
+                     * interrupt of the tick on which it was due. */
+                    if( ( xFromTickInterrupt == pdFALSE ) || ( xItemValue != xTime ) )
                     {
-                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                        uxDeferredUnblocks++;
+                        traceTASK_UNBLOCK_DEFERRED( pxTCB );
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
+                }
+            #endif /* configTICK_MAX_UNBLOCKS */
 
-                    /* Place the unblocked task into the appropriate ready
-                     * list. */
-                    prvAddTaskToReadyList( pxTCB );
+            /* It is time to remove the item from the Blocked state. */
+            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+            /* Is the task waiting on an event also?  If so remove
+             * it from the event list. */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Place the unblocked task into the appropriate ready
+             * list. */
+            prvAddTaskToReadyList( pxTCB );
+
+            /* A task being unblocked cannot cause an immediate
+             * context switch if preemption is turned off. */
+            #if ( configUSE_PREEMPTION == 1 )
+                {
+                    /* Preemption is on, but a context switch should
+                     * only be performed if the unblocked task has a
+                     * priority that is equal to or higher than the
+                     * currently executing task. */
+                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* configUSE_PREEMPTION */
+        }
+    }
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskIncrementTick( void )
+{
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    /* Called by the portable layer each time a tick interrupt occurs.
+     * Increments the tick then checks to see if the new tick value will cause any
+     * tasks to be unblocked. */
+    traceTASK_INCREMENT_TICK( xTickCount );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        /* Minor optimisation.  The tick count cannot change in this
+         * block. */
+        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
+
+        /* Increment the RTOS tick, switching the delayed and overflowed
+         * delayed lists if it wraps to 0. */
+        xTickCount = xConstTickCount;
 
-                    /* A task being unblocked cannot cause an immediate
-                     * context switch if preemption is turned off. */
-                    #if ( configUSE_PREEMPTION == 1 )
+        if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+        {
+            #if ( configTICK_MAX_UNBLOCKS > 0 )
+                {
+                    /* Any tasks still in the delayed list were left by earlier
+                     * ticks and are all due.  They must be unblocked before
+                     * the lists are switched, however many there are. */
+                    while( taskDELAYED_LIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE )
+                    {
+                        if( prvUnblockDelayedTasks( portMAX_DELAY, pdFALSE ) != pdFALSE )
                         {
-                            /* Preemption is on, but a context switch should
-                             * only be performed if the unblocked task has a
-                             * priority that is equal to or higher than the
-                             * currently executing task. */
-                            if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                            {
-                                xSwitchRequired = pdTRUE;
-                            }
-                            else
-                            {
-                                mtCOVERAGE_TEST_MARKER();
-                            }
+                            xSwitchRequired = pdTRUE;
                         }
-                    #endif /* configUSE_PREEMPTION */
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
                 }
+            #endif /* configTICK_MAX_UNBLOCKS */
+
+            taskSWITCH_DELAYED_LISTS();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* See if this tick has made a timeout expire. */
+        if( xConstTickCount >= xNextTaskUnblockTime )
+        {
+            if( prvUnblockDelayedTasks( xConstTickCount, pdTRUE ) != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Fast timers are processed here rather than by the timer service
+         * task, so their callback functions run on the tick they expire. */
+        #if ( configUSE_FAST_TIMERS == 1 )
+            {
+                vTimerProcessFastTimers( xConstTickCount );
+            }
+        #endif /* configUSE_FAST_TIMERS */
 
         /* Tasks of equal priority to the currently running task will share
          * processing time (time slice) if preemption is on, and the application
          * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
             {
                 if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
                 {
@@ -2848,6 +3484,37 @@ BaseType_t xTaskIncrementTick( void )
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
+        #elif ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+            {
+                BaseType_t xCoreID, xOtherCoreID;
+                UBaseType_t uxPriority, uxRunning;
+
+                /* A core only has to switch if the ready list at the priority
+                 * of its task holds more tasks than are running at that
+                 * priority across all the cores. */
+                for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    uxPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+                    uxRunning = ( UBaseType_t ) 0U;
+
+                    for( xOtherCoreID = ( BaseType_t ) 0; xOtherCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xOtherCoreID++ )
+                    {
+                        if( pxCurrentTCBs[ xOtherCoreID ]->uxPriority == uxPriority )
+                        {
+                            uxRunning++;
+                        }
+                    }
+
+                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxPriority ] ) ) > uxRunning )
+                    {
+                        prvYieldCore( xCoreID );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
         #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
         #if ( configUSE_TICK_HOOK == 1 )
@@ -3007,80 +3674,297 @@ BaseType_t xTaskIncrementTick( void )
 #endif /* configUSE_APPLICATION_TASK_TAG */
 /*-----------------------------------------------------------*/
 
-void vTaskSwitchContext( void )
-{
-    if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-    {
-        /* The scheduler is currently suspended - do not allow a context
-         * switch. */
-        xYieldPending = pdTRUE;
-    }
-    else
+#if ( configNUMBER_OF_CORES == 1 )
+
+    void vTaskSwitchContext( void )
     {
-        xYieldPending = pdFALSE;
-        traceTASK_SWITCHED_OUT();
+        if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+        {
+            /* The scheduler is currently suspended - do not allow a context
+             * switch. */
+            xYieldPending = pdTRUE;
+        }
+        else
+        {
+            #if ( configTICK_MAX_UNBLOCKS > 0 )
+                {
+                    /* Unblock tasks the tick interrupt left in the delayed list
+                     * because it reached configTICK_MAX_UNBLOCKS.  A task that
+                     * should preempt is selected below. */
+                    if( xTickCount >= xNextTaskUnblockTime )
+                    {
+                        ( void ) prvUnblockDelayedTasks( xTickCount, pdFALSE );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* configTICK_MAX_UNBLOCKS */
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
-            {
-                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-                #else
-                    ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-                #endif
+            xYieldPending = pdFALSE;
+            traceTASK_SWITCHED_OUT();
 
-                /* Add the amount of time the task has been running to the
-                 * accumulated time so far.  The time the task started running was
-                 * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-                 * protection here so count values are only valid until the timer
-                 * overflows.  The guard against negative values is to protect
-                 * against suspect run time stat counter implementations - which
-                 * are provided by the application, not the kernel. */
-                if( ulTotalRunTime > ulTaskSwitchedInTime )
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
                 {
-                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+                    #else
+                        ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                    #endif
+
+                    /* Add the amount of time the task has been running to the
+                     * accumulated time so far.  The time the task started running was
+                     * stored in ulTaskSwitchedInTime.  Note that there is no overflow
+                     * protection here so count values are only valid until the timer
+                     * overflows.  The guard against negative values is to protect
+                     * against suspect run time stat counter implementations - which
+                     * are provided by the application, not the kernel. */
+                    if( ulTotalRunTime > ulTaskSwitchedInTime )
+                    {
+                        pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ulTaskSwitchedInTime = ulTotalRunTime;
                 }
-                else
+            #endif /* configGENERATE_RUN_TIME_STATS */
+
+            /* Check for stack overflow, if configured. */
+            taskCHECK_FOR_STACK_OVERFLOW();
+
+            /* Before the currently running task is switched out, save its errno. */
+            #if ( configUSE_POSIX_ERRNO == 1 )
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
                 }
+            #endif
 
-                ulTaskSwitchedInTime = ulTotalRunTime;
-            }
-        #endif /* configGENERATE_RUN_TIME_STATS */
+            /* Select a new task to run using either the generic C or port
+             * optimised asm code. */
+            taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            traceTASK_SWITCHED_IN();
+
+            /* After the new task is switched in, update the global errno. */
+            #if ( configUSE_POSIX_ERRNO == 1 )
+                {
+                    FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+                }
+            #endif
+
+            #if ( configUSE_NEWLIB_REENTRANT == 1 )
+                {
+                    /* Switch Newlib's _impure_ptr variable to point to the _reent
+                     * structure specific to this task.
+                     * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+                     * for additional information. */
+                    _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+                }
+            #endif /* configUSE_NEWLIB_REENTRANT */
+        }
+    }
+
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
 
-        /* Check for stack overflow, if configured. */
-        taskCHECK_FOR_STACK_OVERFLOW();
+    void vTaskSwitchContext( BaseType_t xCoreID )
+    {
+        /* Both locks are taken so no other core can change the ready lists,
+         * or select a task to run, while this core selects its task. */
+        portGET_TASK_LOCK();
+        portGET_ISR_LOCK();
+        {
+            xYieldRequests[ xCoreID ] = pdFALSE;
 
-        /* Before the currently running task is switched out, save its errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
+            if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
             {
-                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+                /* The scheduler is currently suspended - do not allow a context
+                 * switch. */
+                xYieldPendings[ xCoreID ] = pdTRUE;
             }
-        #endif
+            else
+            {
+                #if ( configTICK_MAX_UNBLOCKS > 0 )
+                    {
+                        /* Unblock tasks the tick interrupt left in the delayed
+                         * list because it reached configTICK_MAX_UNBLOCKS.  This
+                         * is done before this core's yield pending flag is
+                         * cleared as this core selects its task below. */
+                        if( xTickCount >= xNextTaskUnblockTime )
+                        {
+                            ( void ) prvUnblockDelayedTasks( xTickCount, pdFALSE );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* configTICK_MAX_UNBLOCKS */
 
-        /* Select a new task to run using either the generic C or port
-         * optimised asm code. */
-        taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-        traceTASK_SWITCHED_IN();
+                xYieldPendings[ xCoreID ] = pdFALSE;
+                traceTASK_SWITCHED_OUT();
+
+                /* Check for stack overflow, if configured. */
+                taskCHECK_FOR_STACK_OVERFLOW();
+
+                /* Before the currently running task is switched out, save its errno. */
+                #if ( configUSE_POSIX_ERRNO == 1 )
+                    {
+                        pxCurrentTCBs[ xCoreID ]->iTaskErrno = FreeRTOS_errno;
+                    }
+                #endif
+
+                /* Select a new task to run. */
+                prvSelectHighestPriorityTask( xCoreID );
+                traceTASK_SWITCHED_IN();
+
+                /* After the new task is switched in, update the global errno. */
+                #if ( configUSE_POSIX_ERRNO == 1 )
+                    {
+                        FreeRTOS_errno = pxCurrentTCBs[ xCoreID ]->iTaskErrno;
+                    }
+                #endif
+
+                #if ( configUSE_NEWLIB_REENTRANT == 1 )
+                    {
+                        /* Switch Newlib's _impure_ptr variable to point to the _reent
+                         * structure specific to this task.
+                         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+                         * for additional information. */
+                        _impure_ptr = &( pxCurrentTCBs[ xCoreID ]->xNewLib_reent );
+                    }
+                #endif /* configUSE_NEWLIB_REENTRANT */
+            }
+        }
+        portRELEASE_ISR_LOCK();
+        portRELEASE_TASK_LOCK();
+    }
+/*-----------------------------------------------------------*/
 
-        /* After the new task is switched in, update the global errno. */
-        #if ( configUSE_POSIX_ERRNO == 1 )
+    static void prvSelectHighestPriorityTask( BaseType_t xCoreID )
+    {
+        UBaseType_t uxCurrentPriority = uxTopReadyPriority;
+        BaseType_t xTaskScheduled = pdFALSE;
+        BaseType_t xDecrementTopPriority = pdTRUE;
+        List_t * pxReadyList;
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+
+        /* Must be called with both the task lock and the ISR lock held. */
+        while( xTaskScheduled == pdFALSE )
+        {
+            pxReadyList = &( pxReadyTasksLists[ uxCurrentPriority ] );
+
+            if( listLIST_IS_EMPTY( pxReadyList ) == pdFALSE )
             {
-                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+                /* uxTopReadyPriority must not be lowered past a priority that
+                 * has ready tasks, even if they are all running on other
+                 * cores. */
+                xDecrementTopPriority = pdFALSE;
+
+                /* Search the list starting from the task after the one most
+                 * recently selected at this priority so tasks of equal priority
+                 * share the cores in turn.  The first task that is not running,
+                 * or is already running on this core, is selected. */
+                pxIterator = pxReadyList->pxIndex;
+
+                do
+                {
+                    pxIterator = listGET_NEXT( pxIterator );
+
+                    if( pxIterator != ( ListItem_t * ) listGET_END_MARKER( pxReadyList ) )
+                    {
+                        pxTCB = listGET_LIST_ITEM_OWNER( pxIterator ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                        if( ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) || ( pxTCB->xTaskRunState == xCoreID ) )
+                        {
+                            pxReadyList->pxIndex = pxIterator;
+
+                            if( pxCurrentTCBs[ xCoreID ] != NULL )
+                            {
+                                pxCurrentTCBs[ xCoreID ]->xTaskRunState = taskTASK_NOT_RUNNING;
+                            }
+
+                            pxTCB->xTaskRunState = xCoreID;
+                            pxCurrentTCBs[ xCoreID ] = pxTCB;
+                            xTaskScheduled = pdTRUE;
+                            break;
+                        }
+                    }
+                } while( pxIterator != pxReadyList->pxIndex );
             }
-        #endif
 
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            if( xTaskScheduled == pdFALSE )
             {
-                /* Switch Newlib's _impure_ptr variable to point to the _reent
-                 * structure specific to this task.
-                 * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-                 * for additional information. */
-                _impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+                /* There is one idle task per core so a task is always found
+                 * before the idle priority is passed. */
+                configASSERT( uxCurrentPriority > tskIDLE_PRIORITY );
+
+                if( xDecrementTopPriority != pdFALSE )
+                {
+                    uxTopReadyPriority--;
+                }
+
+                uxCurrentPriority--;
             }
-        #endif /* configUSE_NEWLIB_REENTRANT */
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvYieldCore( BaseType_t xCoreID )
+    {
+        if( xCoreID == portGET_CORE_ID() )
+        {
+            /* The calling core yields when it leaves the kernel. */
+            xYieldPendings[ xCoreID ] = pdTRUE;
+        }
+        else
+        {
+            xYieldRequests[ xCoreID ] = pdTRUE;
+            portYIELD_CORE( xCoreID );
+        }
     }
-}
+/*-----------------------------------------------------------*/
+
+    static void prvYieldForTask( TCB_t * pxTCB )
+    {
+        BaseType_t xCoreID;
+        BaseType_t xLowestPriorityCore = ( BaseType_t ) -1;
+        UBaseType_t uxLowestPriority = pxTCB->uxPriority;
+
+        if( ( xSchedulerRunning != pdFALSE ) && ( taskTASK_IS_RUNNING( pxTCB ) == pdFALSE ) )
+        {
+            /* Find the core running the lowest priority task that has a lower
+             * priority than pxTCB.  Cores that have already been asked to
+             * yield will select the best task anyway, so are skipped. */
+            for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                if( ( pxCurrentTCBs[ xCoreID ]->uxPriority < uxLowestPriority ) &&
+                    ( xYieldRequests[ xCoreID ] == pdFALSE ) )
+                {
+                    uxLowestPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+                    xLowestPriorityCore = xCoreID;
+                }
+            }
+
+            #if ( configUSE_PREEMPTION == 1 )
+                {
+                    if( xLowestPriorityCore >= ( BaseType_t ) 0 )
+                    {
+                        prvYieldCore( xLowestPriorityCore );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* configUSE_PREEMPTION */
+        }
+    }
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 /*-----------------------------------------------------------*/
 
 void vTaskPlaceOnEventList( List_t * const pxEventList,
@@ -3127,6 +4011,24 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configEVENT_GROUP_64BIT == 1 )
+
+    void vTaskPlaceOnUnorderedEventList64( List_t * pxEventList,
+                                           const uint64_t ullItemValue,
+                                           const TickType_t xTicksToWait )
+    {
+        /* The value is held in the TCB as the event list item value is too
+         * narrow.  The scheduler is suspended so the TCB of the calling task can
+         * be accessed. */
+        configASSERT( uxSchedulerSuspended != 0 );
+        pxCurrentTCB->ullEventItemValue = ullItemValue;
+
+        vTaskPlaceOnUnorderedEventList( pxEventList, ( TickType_t ) 0, xTicksToWait );
+    }
+
+#endif /* configEVENT_GROUP_64BIT */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TIMERS == 1 )
 
     void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
@@ -3242,41 +4144,142 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     /* Store the new item value in the event list. */
     listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
 
-    /* Remove the event list form the event flag.  Interrupts do not access
-     * event flags. */
-    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-    configASSERT( pxUnblockedTCB );
-    ( void ) uxListRemove( pxEventListItem );
+    /* Remove the event list form the event flag.  Interrupts do not access
+     * event flags. */
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    configASSERT( pxUnblockedTCB );
+    ( void ) uxListRemove( pxEventListItem );
+
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        {
+            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
+             * might be set to the blocked task's time out time.  If the task is
+             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
+             * normally left unchanged, because it is automatically reset to a new
+             * value when the tick count equals xNextTaskUnblockTime.  However if
+             * tickless idling is used it might be more important to enter sleep mode
+             * at the earliest possible time - so reset xNextTaskUnblockTime here to
+             * ensure it is updated at the earliest possible time. */
+            prvResetNextTaskUnblockTime();
+        }
+    #endif
+
+    /* Remove the task from the delayed list and add it to the ready list.  The
+     * scheduler is suspended so interrupts will not be accessing the ready
+     * lists. */
+    ( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+    prvAddTaskToReadyList( pxUnblockedTCB );
+
+    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    {
+        /* The unblocked task has a priority above that of the calling task, so
+         * a context switch is required.  This function is called with the
+         * scheduler suspended so xYieldPending is set so the context switch
+         * occurs immediately that the scheduler is resumed (unsuspended). */
+        xYieldPending = pdTRUE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configEVENT_GROUP_64BIT == 1 )
+
+    void vTaskRemoveFromUnorderedEventList64( ListItem_t * pxEventListItem,
+                                              const uint64_t ullItemValue )
+    {
+        TCB_t * pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        configASSERT( pxUnblockedTCB );
+        pxUnblockedTCB->ullEventItemValue = ullItemValue;
+
+        vTaskRemoveFromUnorderedEventList( pxEventListItem, ( TickType_t ) 0 );
+    }
+
+#endif /* configEVENT_GROUP_64BIT */
+/*-----------------------------------------------------------*/
+
+#if ( configEVENT_GROUP_DIRECT_ISR == 1 )
+
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TickType_t xItemValue )
+    {
+        TCB_t * pxUnblockedTCB;
+        BaseType_t xReturn;
+
+        /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION WITHIN AN ISR.  It
+         * is used by the event groups implementation when tasks only access
+         * event groups from within critical sections, so the event list can be
+         * accessed here. */
+
+        /* Store the new item value in the event list. */
+        listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+        pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        configASSERT( pxUnblockedTCB );
+        ( void ) uxListRemove( pxEventListItem );
+
+        if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+        {
+            ( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+            prvAddTaskToReadyList( pxUnblockedTCB );
+
+            #if ( configUSE_TICKLESS_IDLE != 0 )
+                {
+                    /* See the comment in xTaskRemoveFromEventList(). */
+                    prvResetNextTaskUnblockTime();
+                }
+            #endif
+        }
+        else
+        {
+            /* The delayed and ready lists cannot be accessed, so hold this task
+             * pending until the scheduler is resumed. */
+            vListInsertEnd( &( xPendingReadyList ), pxEventListItem );
+        }
+
+        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        {
+            /* Mark that a yield is pending in case the caller is not using the
+             * "xHigherPriorityTaskWoken" parameter. */
+            xReturn = pdTRUE;
+            xYieldPending = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configEVENT_GROUP_DIRECT_ISR */
+/*-----------------------------------------------------------*/
+
+#if ( ( configEVENT_GROUP_DIRECT_ISR == 1 ) && ( configEVENT_GROUP_64BIT == 1 ) )
+
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR64( ListItem_t * pxEventListItem,
+                                                           const uint64_t ullItemValue )
+    {
+        TCB_t * pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        configASSERT( pxUnblockedTCB );
+        pxUnblockedTCB->ullEventItemValue = ullItemValue;
+
+        return xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, ( TickType_t ) 0 );
+    }
 
-    #if ( configUSE_TICKLESS_IDLE != 0 )
-        {
-            /* If a task is blocked on a kernel object then xNextTaskUnblockTime
-             * might be set to the blocked task's time out time.  If the task is
-             * unblocked for a reason other than a timeout xNextTaskUnblockTime is
-             * normally left unchanged, because it is automatically reset to a new
-             * value when the tick count equals xNextTaskUnblockTime.  However if
-             * tickless idling is used it might be more important to enter sleep mode
-             * at the earliest possible time - so reset xNextTaskUnblockTime here to
-             * ensure it is updated at the earliest possible time. */
-            prvResetNextTaskUnblockTime();
-        }
-    #endif
+#endif /* if ( ( configEVENT_GROUP_DIRECT_ISR == 1 ) && ( configEVENT_GROUP_64BIT == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-    /* Remove the task from the delayed list and add it to the ready list.  The
-     * scheduler is suspended so interrupts will not be accessing the ready
-     * lists. */
-    ( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
-    prvAddTaskToReadyList( pxUnblockedTCB );
+#if ( configEVENT_GROUP_64BIT == 1 )
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    uint64_t ullTaskGetEventItemValue64( const ListItem_t * pxEventListItem )
     {
-        /* The unblocked task has a priority above that of the calling task, so
-         * a context switch is required.  This function is called with the
-         * scheduler suspended so xYieldPending is set so the context switch
-         * occurs immediately that the scheduler is resumed (unsuspended). */
-        xYieldPending = pdTRUE;
+        const TCB_t * pxTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        return pxTCB->ullEventItemValue;
     }
-}
+
+#endif /* configEVENT_GROUP_64BIT */
 /*-----------------------------------------------------------*/
 
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
@@ -3457,10 +4460,11 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                  * timeslice.
                  *
                  * A critical region is not required here as we are just reading from
-                 * the list, and an occasional incorrect value will not matter.  If
-                 * the ready list at the idle priority contains more than one task
-                 * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                 * the list, and an occasional incorrect value will not matter.  There
+                 * is one idle task per core, so if the ready list at the idle priority
+                 * contains more tasks than there are cores then a task other than an
+                 * idle task is ready to execute. */
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
                 {
                     taskYIELD();
                 }
@@ -3537,6 +4541,41 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static portTASK_FUNCTION( prvPassiveIdleTask, pvParameters )
+    {
+        /* Stop warnings. */
+        ( void ) pvParameters;
+
+        for( ; ; )
+        {
+            #if ( configUSE_PREEMPTION == 0 )
+                {
+                    /* See the comments in prvIdleTask(). */
+                    taskYIELD();
+                }
+            #endif /* configUSE_PREEMPTION */
+
+            #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+                {
+                    /* See the comments in prvIdleTask(). */
+                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+                    {
+                        taskYIELD();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+        }
+    }
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TICKLESS_IDLE != 0 )
 
     eSleepModeStatus eTaskConfirmSleepModeStatus( void )
@@ -3654,8 +4693,17 @@ static void prvInitialiseTaskLists( void )
         vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
     }
 
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
+    #if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+        {
+            prvDelayedListInitialise( &xDelayedTaskList1 );
+            prvDelayedListInitialise( &xDelayedTaskList2 );
+        }
+    #else
+        {
+            vListInitialise( &xDelayedTaskList1 );
+            vListInitialise( &xDelayedTaskList2 );
+        }
+    #endif
     vListInitialise( &xPendingReadyList );
 
     #if ( INCLUDE_vTaskDelete == 1 )
@@ -3689,14 +4737,50 @@ static void prvCheckTasksWaitingTermination( void )
              * being called too often in the idle task. */
             while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
             {
-                taskENTER_CRITICAL();
-                {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    --uxCurrentNumberOfTasks;
-                    --uxDeletedTasksWaitingCleanUp;
-                }
-                taskEXIT_CRITICAL();
+                #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                            --uxCurrentNumberOfTasks;
+                            --uxDeletedTasksWaitingCleanUp;
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                #else /* if ( configNUMBER_OF_CORES == 1 ) */
+                    {
+                        pxTCB = NULL;
+
+                        taskENTER_CRITICAL();
+                        {
+                            /* A task that deleted itself may still be running
+                             * on another core until that core switches it out,
+                             * in which case it is left for a later pass. */
+                            if( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+                            {
+                                pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                                if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
+                                {
+                                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                                    --uxCurrentNumberOfTasks;
+                                    --uxDeletedTasksWaitingCleanUp;
+                                }
+                                else
+                                {
+                                    pxTCB = NULL;
+                                }
+                            }
+                        }
+                        taskEXIT_CRITICAL();
+
+                        if( pxTCB == NULL )
+                        {
+                            break;
+                        }
+                    }
+                #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
                 prvDeleteTCB( pxTCB );
             }
@@ -3748,7 +4832,7 @@ static void prvCheckTasksWaitingTermination( void )
          * state is just set to whatever is passed in. */
         if( eState != eInvalid )
         {
-            if( pxTCB == pxCurrentTCB )
+            if( taskTASK_IS_RUNNING( pxTCB ) )
             {
                 pxTaskStatus->eCurrentState = eRunning;
             }
@@ -3987,40 +5071,315 @@ static void prvCheckTasksWaitingTermination( void )
 
 static void prvResetNextTaskUnblockTime( void )
 {
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    #if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+        {
+            /* portMAX_DELAY if the new current delayed list is empty. */
+            xNextTaskUnblockTime = prvDelayedListGetNextTime( pxDelayedTaskList );
+        }
+    #else
+        {
+            if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+            {
+                /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+                 * the maximum possible value so it is  extremely unlikely that the
+                 * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+                 * there is an item in the delayed list. */
+                xNextTaskUnblockTime = portMAX_DELAY;
+            }
+            else
+            {
+                /* The new current delayed list is not empty, get the value of
+                 * the item at the head of the delayed list.  This is the time at
+                 * which the task at the head of the delayed list should be removed
+                 * from the Blocked state. */
+                xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+            }
+        }
+    #endif /* configUSE_RADIX_DELAYED_LISTS */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RADIX_DELAYED_LISTS == 1 )
+
+    static size_t prvDelayedListBucket( TickType_t xDifference )
     {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
+        size_t xShift, xBucket = ( size_t ) 0;
+
+        /* The bucket is the number of bits needed to hold xDifference, found
+         * by halving the width searched on each step. */
+        for( xShift = sizeof( TickType_t ) * ( size_t ) 4; xShift > ( size_t ) 0; xShift >>= 1 )
+        {
+            if( ( xDifference >> xShift ) != ( TickType_t ) 0U )
+            {
+                xDifference >>= xShift;
+                xBucket += xShift;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xBucket + ( size_t ) xDifference;
     }
-    else
+/*-----------------------------------------------------------*/
+
+    static void prvDelayedListInitialise( DelayedList_t * const pxDelayedList )
     {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        size_t xBucket;
+
+        pxDelayedList->xBaseTime = ( TickType_t ) 0U;
+
+        for( xBucket = ( size_t ) 0; xBucket < taskDELAYED_LIST_BUCKETS; xBucket++ )
+        {
+            vListInitialise( &( pxDelayedList->xBuckets[ xBucket ] ) );
+        }
     }
-}
+/*-----------------------------------------------------------*/
+
+    static void prvDelayedListInsert( DelayedList_t * const pxDelayedList,
+                                      ListItem_t * const pxNewListItem )
+    {
+        const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxNewListItem );
+
+        /* A task can not wake before the tick count, so can not wake before
+         * the base time either. */
+        configASSERT( xTimeToWake >= pxDelayedList->xBaseTime );
+
+        vListInsertEnd( &( pxDelayedList->xBuckets[ prvDelayedListBucket( xTimeToWake ^ pxDelayedList->xBaseTime ) ] ), pxNewListItem );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvDelayedListIsEmpty( const DelayedList_t * const pxDelayedList )
+    {
+        size_t xBucket;
+        BaseType_t xReturn = pdTRUE;
+
+        for( xBucket = ( size_t ) 0; xBucket < taskDELAYED_LIST_BUCKETS; xBucket++ )
+        {
+            if( listLIST_IS_EMPTY( &( pxDelayedList->xBuckets[ xBucket ] ) ) == pdFALSE )
+            {
+                xReturn = pdFALSE;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvListIsWithinDelayedList( const List_t * const pxList,
+                                                  const DelayedList_t * const pxDelayedList )
+    {
+        size_t xBucket;
+        BaseType_t xReturn = pdFALSE;
+
+        for( xBucket = ( size_t ) 0; xBucket < taskDELAYED_LIST_BUCKETS; xBucket++ )
+        {
+            if( pxList == &( pxDelayedList->xBuckets[ xBucket ] ) )
+            {
+                xReturn = pdTRUE;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvDelayedListFindNext( const DelayedList_t * const pxDelayedList,
+                                              size_t * const pxBucket )
+    {
+        size_t xBucket;
+        TickType_t xItemValue, xNextTime = portMAX_DELAY;
+        const ListItem_t * pxItem;
+        const ListItem_t * pxEnd;
+
+        /* The earliest wake time is in the lowest bucket that is not empty. */
+        for( xBucket = ( size_t ) 0; xBucket < taskDELAYED_LIST_BUCKETS; xBucket++ )
+        {
+            if( listLIST_IS_EMPTY( &( pxDelayedList->xBuckets[ xBucket ] ) ) == pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xBucket == ( size_t ) 0 )
+        {
+            /* Every task in bucket 0 wakes at the base time. */
+            xNextTime = pxDelayedList->xBaseTime;
+        }
+        else if( xBucket < taskDELAYED_LIST_BUCKETS )
+        {
+            /* The other buckets are not sorted. */
+            pxEnd = listGET_END_MARKER( &( pxDelayedList->xBuckets[ xBucket ] ) );
+
+            for( pxItem = listGET_HEAD_ENTRY( &( pxDelayedList->xBuckets[ xBucket ] ) ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+            {
+                xItemValue = listGET_LIST_ITEM_VALUE( pxItem );
+
+                if( xItemValue < xNextTime )
+                {
+                    xNextTime = xItemValue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            /* The delayed list is empty. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        *pxBucket = xBucket;
+
+        return xNextTime;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvDelayedListGetNextTime( const DelayedList_t * const pxDelayedList )
+    {
+        size_t xBucket;
+
+        return prvDelayedListFindNext( pxDelayedList, &xBucket );
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvDelayedListCollectDue( DelayedList_t * const pxDelayedList,
+                                                const TickType_t xTime )
+    {
+        size_t xBucket;
+        List_t * pxBucketList;
+        ListItem_t * pxItem;
+        const TickType_t xNextTime = prvDelayedListFindNext( pxDelayedList, &xBucket );
+
+        if( ( xBucket > ( size_t ) 0 ) && ( xBucket < taskDELAYED_LIST_BUCKETS ) && ( xNextTime <= xTime ) )
+        {
+            /* Move the base time up to the earliest wake time.  The tasks in
+             * the buckets above keep their bucket, as their wake times differ
+             * from the new base time in the same bit as from the old.  Every
+             * task in the earliest wake time's bucket moves to a lower bucket,
+             * the tasks that wake at the new base time to bucket 0. */
+            pxDelayedList->xBaseTime = xNextTime;
+            pxBucketList = &( pxDelayedList->xBuckets[ xBucket ] );
+
+            while( listLIST_IS_EMPTY( pxBucketList ) == pdFALSE )
+            {
+                pxItem = listGET_HEAD_ENTRY( pxBucketList );
+                ( void ) uxListRemove( pxItem );
+                vListInsertEnd( &( pxDelayedList->xBuckets[ prvDelayedListBucket( listGET_LIST_ITEM_VALUE( pxItem ) ^ xNextTime ) ] ), pxItem );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xNextTime;
+    }
+
+#endif /* configUSE_RADIX_DELAYED_LISTS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 ) && !defined( __GNUC__ ) )
+
+    static UBaseType_t prvHighestSetBit( uint32_t ulBits )
+    {
+        /* The most significant set bit in each possible nibble value. */
+        static const uint8_t ucHighestBitInNibble[ 16 ] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+        UBaseType_t uxBitNumber = 0;
+
+        /* Narrow the search down to a single nibble in a fixed number of
+         * steps so the time taken does not depend on the value. */
+        if( ( ulBits & 0xffff0000UL ) != 0UL )
+        {
+            ulBits >>= 16;
+            uxBitNumber += 16;
+        }
+
+        if( ( ulBits & 0x0000ff00UL ) != 0UL )
+        {
+            ulBits >>= 8;
+            uxBitNumber += 8;
+        }
+
+        if( ( ulBits & 0x000000f0UL ) != 0UL )
+        {
+            ulBits >>= 4;
+            uxBitNumber += 4;
+        }
+
+        return uxBitNumber + ( UBaseType_t ) ucHighestBitInNibble[ ulBits ];
+    }
+
+#endif /* if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP_TASK_SELECTION == 1 ) && !defined( __GNUC__ ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
 
+    #if ( configNUMBER_OF_CORES == 1 )
+
+        TaskHandle_t xTaskGetCurrentTaskHandle( void )
+        {
+            TaskHandle_t xReturn;
+
+            /* A critical section is not required as this is not called from
+             * an interrupt and the current TCB will always be the same for any
+             * individual execution thread. */
+            xReturn = pxCurrentTCB;
+
+            return xReturn;
+        }
+
+    #endif /* configNUMBER_OF_CORES */
+
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    /* pxCurrentTCB is defined in terms of xTaskGetCurrentTaskHandle() when
+     * there is more than one core, so it is always available. */
     TaskHandle_t xTaskGetCurrentTaskHandle( void )
     {
         TaskHandle_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
 
-        /* A critical section is not required as this is not called from
-         * an interrupt and the current TCB will always be the same for any
-         * individual execution thread. */
-        xReturn = pxCurrentTCB;
+        /* Interrupts are masked so the calling task cannot be switched to a
+         * different core between reading the core ID and reading the TCB. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+        {
+            xReturn = pxCurrentTCBs[ portGET_CORE_ID() ];
+        }
+        portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
 
         return xReturn;
     }
+/*-----------------------------------------------------------*/
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+    TaskHandle_t xTaskGetCurrentTaskHandleForCore( BaseType_t xCoreID )
+    {
+        configASSERT( ( xCoreID >= ( BaseType_t ) 0 ) && ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) );
+
+        return pxCurrentTCBs[ xCoreID ];
+    }
+
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
@@ -4662,6 +6021,23 @@ TickType_t uxTaskResetEventItemValue( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configEVENT_GROUP_64BIT == 1 )
+
+    uint64_t ullTaskResetEventItemValue64( void )
+    {
+        uint64_t ullReturn;
+
+        /* Other tasks only write the value while the calling task is in the
+         * Blocked state, so it can be read without a critical section. */
+        ullReturn = pxCurrentTCB->ullEventItemValue;
+        ( void ) uxTaskResetEventItemValue();
+
+        return ullReturn;
+    }
+
+#endif /* configEVENT_GROUP_64BIT */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_MUTEXES == 1 )
 
     TaskHandle_t pvTaskIncrementMutexHeldCount( void )
@@ -5311,13 +6687,13 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                 {
                     /* Wake time has overflowed.  Place this item in the overflow
                      * list. */
-                    vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                    taskDELAYED_LIST_INSERT( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
                 }
                 else
                 {
                     /* The wake time has not overflowed, so the current block list
                      * is used. */
-                    vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                    taskDELAYED_LIST_INSERT( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
                     /* If the task entering the blocked state was placed at the
                      * head of the list of blocked tasks then xNextTaskUnblockTime
@@ -5346,12 +6722,12 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
             if( xTimeToWake < xConstTickCount )
             {
                 /* Wake time has overflowed.  Place this item in the overflow list. */
-                vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                taskDELAYED_LIST_INSERT( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
             }
             else
             {
                 /* The wake time has not overflowed, so the current block list is used. */
-                vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                taskDELAYED_LIST_INSERT( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 
                 /* If the task entering the blocked state was placed at the head of the
                  * list of blocked tasks then xNextTaskUnblockTime needs to be updated
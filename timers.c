@@ -41,6 +41,10 @@
     #error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
 
+#if ( configUSE_FAST_TIMERS == 1 ) && ( configUSE_TIMERS == 0 )
+    #error configUSE_TIMERS must be set to 1 to make fast timers available.
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -67,6 +71,46 @@
     #define tmrSTATUS_IS_ACTIVE                  ( ( uint8_t ) 0x01 )
     #define tmrSTATUS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 0x02 )
     #define tmrSTATUS_IS_AUTORELOAD              ( ( uint8_t ) 0x04 )
+    #define tmrSTATUS_IS_FAST                    ( ( uint8_t ) 0x08 )
+
+/* When configTIMER_USE_WHEEL is 1 the timers that expire before the tick count
+ * next overflows are held in a hierarchical timing wheel rather than a sorted
+ * list, so a timer can be started, stopped or reset in constant time.  Each
+ * level of the wheel has tmrWHEEL_SLOTS slots, and each level covers the next
+ * tmrWHEEL_SLOT_BITS bits of the tick count up from the level below it. */
+    #if ( configTIMER_USE_WHEEL == 1 )
+        #define tmrWHEEL_SLOT_BITS     ( 4U )
+        #define tmrWHEEL_SLOTS         ( 1U << tmrWHEEL_SLOT_BITS )
+        #define tmrWHEEL_SLOT_MASK     ( ( TickType_t ) tmrWHEEL_SLOTS - ( TickType_t ) 1U )
+        #define tmrWHEEL_LEVELS        ( ( ( sizeof( TickType_t ) * ( size_t ) 8 ) + tmrWHEEL_SLOT_BITS - 1U ) / tmrWHEEL_SLOT_BITS )
+    #endif
+
+/* When configTIMER_DIRECT_COMMANDS is 1 tasks can start, stop and reset timers
+ * by updating the active timer lists themselves, so the timer service task must
+ * also suspend the scheduler while it accesses the lists.  Otherwise only the
+ * timer service task accesses the lists. */
+    #if ( configTIMER_DIRECT_COMMANDS == 1 )
+        #define tmrENTER_LIST_ACCESS()    vTaskSuspendAll()
+        #define tmrEXIT_LIST_ACCESS()     ( void ) xTaskResumeAll()
+    #else
+        #define tmrENTER_LIST_ACCESS()
+        #define tmrEXIT_LIST_ACCESS()
+    #endif
+
+/* The timer service that manages a timer.  There is only one when
+ * configTIMER_SERVICE_COUNT is 1, so it is not stored in the timer. */
+    #if ( configTIMER_SERVICE_COUNT > 1 )
+        #define tmrGET_SERVICE( pxTimer )    ( ( pxTimer )->pxService )
+    #else
+        #define tmrGET_SERVICE( pxTimer )    ( &( xTimerServices[ 0 ] ) )
+    #endif
+
+/* The priority of the task of a timer service.  Timer service 0 is the timer
+ * service that exists when configTIMER_SERVICE_COUNT is 1, so always uses
+ * configTIMER_TASK_PRIORITY. */
+    #define tmrSERVICE_TASK_PRIORITY( uxService )                                             \
+    ( ( ( uxService ) == ( UBaseType_t ) 0U ) ? ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) : \
+      ( ( UBaseType_t ) configTIMER_SERVICE_TASK_PRIORITY( uxService ) ) )
 
 /* The definition of the timers themselves. */
     typedef struct tmrTimerControl                  /* The old naming convention is used to prevent breaking kernel aware debuggers. */
@@ -79,6 +123,9 @@
         #if ( configUSE_TRACE_FACILITY == 1 )
             UBaseType_t uxTimerNumber;              /*<< An ID assigned by trace tools such as FreeRTOS+Trace */
         #endif
+        #if ( configTIMER_SERVICE_COUNT > 1 )
+            struct tmrTimerService * pxService;     /*<< The timer service that manages the timer. */
+        #endif
         uint8_t ucStatus;                           /*<< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
     } xTIMER;
 
@@ -125,20 +172,53 @@
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
- * time order, with the nearest expiry time at the front of the list.  Only the
- * timer service task is allowed to access these lists.
- * xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
- * breaks some kernel aware debuggers, and debuggers that reply on removing the
- * static qualifier. */
-    PRIVILEGED_DATA static List_t xActiveTimerList1;
-    PRIVILEGED_DATA static List_t xActiveTimerList2;
-    PRIVILEGED_DATA static List_t * pxCurrentTimerList;
-    PRIVILEGED_DATA static List_t * pxOverflowTimerList;
-
-/* A queue that is used to send commands to the timer service task. */
-    PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
-    PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+/* Each timer service has its own timer service task, command queue and active
+ * timer lists, so the callbacks of the timers on one service do not delay the
+ * timers on another.  Service 0 is the timer service that is used by
+ * xTimerCreate() and xTimerPendFunctionCall().
+ *
+ * Active timers are referenced in expire time order, with the nearest expiry
+ * time at the front of the current list.  Timers that expire after the tick
+ * count next overflows are held in the overflow list.  xActiveTimerList1 and
+ * xActiveTimerList2 could be at function scope but that breaks some kernel
+ * aware debuggers, and debuggers that reply on removing the static qualifier.
+ *
+ * When the timing wheel is used it replaces the current timer list, and the
+ * timers in the overflow timer list are moved into the wheel when the lists
+ * would otherwise be switched.  A timer that expires at time xExpiry is held in
+ * the lowest level at which xExpiry and xTimerWheelTime differ only in that
+ * level's bits, or bits of lower levels.  Bit n of ulTimerWheelSlotsInUse[ l ]
+ * is set when a timer is added to xTimerWheel[ l ][ n ].  Timers are removed
+ * from the wheel with uxListRemove(), so a set bit can refer to an empty slot -
+ * the bit is then cleared the next time the slot is checked. */
+    typedef struct tmrTimerService
+    {
+        List_t xActiveTimerList1;
+        List_t xActiveTimerList2;
+        List_t * pxCurrentTimerList;
+        List_t * pxOverflowTimerList;
+        #if ( configTIMER_USE_WHEEL == 1 )
+            List_t xTimerWheel[ tmrWHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+            uint32_t ulTimerWheelSlotsInUse[ tmrWHEEL_LEVELS ];
+            TickType_t xTimerWheelTime;
+        #endif
+        QueueHandle_t xTimerQueue;   /*<< The queue that is used to send commands to the timer service task. */
+        TaskHandle_t xTimerTaskHandle;
+        TickType_t xLastTime;        /*<< The tick count when the timer service task last sampled it.  The active timer lists are not switched until the task sees the tick count overflow, so they only match tick counts that are not below xLastTime. */
+    } TimerService_t;
+
+    PRIVILEGED_DATA static TimerService_t xTimerServices[ configTIMER_SERVICE_COUNT ];
+
+/* Fast timers are held in their own pair of lists, which are accessed from the
+ * tick interrupt, so only from within critical sections.  As with the active
+ * timer lists, timers that expire after the tick count next overflows are held
+ * in the overflow list. */
+    #if ( configUSE_FAST_TIMERS == 1 )
+        PRIVILEGED_DATA static List_t xFastTimerList1;
+        PRIVILEGED_DATA static List_t xFastTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentFastTimerList;
+        PRIVILEGED_DATA static List_t * pxOverflowFastTimerList;
+    #endif
 
 /*lint -restore */
 
@@ -153,7 +233,8 @@
 /*
  * The timer service task (daemon).  Timer functionality is controlled by this
  * task.  Other tasks communicate with the timer service task using the
- * xTimerQueue queue.
+ * xTimerQueue queue of its timer service, which is passed in as the task's
+ * parameter.
  */
     static portTASK_FUNCTION_PROTO( prvTimerTask, pvParameters ) PRIVILEGED_FUNCTION;
 
@@ -161,11 +242,12 @@
  * Called by the timer service task to interpret and process a command it
  * received on the timer queue.
  */
-    static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
+    static void prvProcessReceivedCommands( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
 
 /*
- * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * Insert the timer into either xActiveTimerList1, or xActiveTimerList2, of its
+ * timer service, depending on if the expire time causes a timer counter
+ * overflow.
  */
     static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer,
                                                   const TickType_t xNextExpiryTime,
@@ -173,23 +255,26 @@
                                                   const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto-reload timer, then call its callback.
+ * An active timer has reached its expire time.  Remove it from the active
+ * timers, reloading it if it is an auto-reload timer, and return it so its
+ * callback can be called once the scheduler has been resumed.
  */
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
-                                        const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+    static Timer_t * prvProcessExpiredTimer( TimerService_t * const pxService,
+                                             const TickType_t xNextExpireTime,
+                                             const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
  * current timer list does not still reference some timers.
  */
-    static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+    static void prvSwitchTimerLists( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
-    static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+    static TickType_t prvSampleTimeNow( TimerService_t * const pxService,
+                                        BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
 /*
  * If the timer list contains any active timers then return the expire time of
@@ -197,14 +282,14 @@
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+    static TickType_t prvGetNextExpireTime( TimerService_t * const pxService,
+                                            BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-    static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
-                                            BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+    static void prvProcessTimerOrBlockTask( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
 
 /*
  * Called after a Timer_t structure has been allocated either statically or
@@ -216,54 +301,160 @@
                                        void * const pvTimerID,
                                        TimerCallbackFunction_t pxCallbackFunction,
                                        Timer_t * pxNewTimer ) PRIVILEGED_FUNCTION;
+
+    #if ( configTIMER_USE_WHEEL == 1 )
+
+/*
+ * Add a timer to the slot of the timing wheel that matches its expiry time,
+ * which must not be before xTimerWheelTime.
+ */
+        static void prvWheelInsertTimer( TimerService_t * const pxService,
+                                         Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the time at which the timing wheel next needs attention, either
+ * because a timer expires or because the timers in a slot of a higher level
+ * have to be moved down to a lower level.  *pxWheelWasEmpty is set to pdTRUE,
+ * and 0 is returned, if the wheel does not contain any timers.
+ */
+        static TickType_t prvWheelGetNextEvent( TimerService_t * const pxService,
+                                                BaseType_t * const pxWheelWasEmpty ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move the wheel on to xTime, which must not be later than the time returned
+ * by prvWheelGetNextEvent().  Returns pdTRUE if any timers expire at xTime, in
+ * which case they are in xTimerWheel[ 0 ][ xTime & tmrWHEEL_SLOT_MASK ].
+ */
+        static BaseType_t prvWheelAdvance( TimerService_t * const pxService,
+                                           const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+    #endif /* configTIMER_USE_WHEEL */
+
+    #if ( configTIMER_DIRECT_COMMANDS == 1 )
+
+/*
+ * Apply a start, reset, stop or change period command from a task directly to
+ * the active timer lists, waking the timer service task if the next expire time
+ * moved earlier.  Returns pdFAIL if the command must be sent to the timer
+ * service task instead.
+ */
+        static BaseType_t prvProcessCommandDirectly( Timer_t * const pxTimer,
+                                                     const BaseType_t xCommandID,
+                                                     const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+    #endif /* configTIMER_DIRECT_COMMANDS */
+
+    #if ( configUSE_FAST_TIMERS == 1 )
+
+/*
+ * Apply a command to a fast timer.  Fast timers are not managed by the timer
+ * service task, so the command is applied before this function returns.
+ */
+        static BaseType_t prvProcessFastTimerCommand( Timer_t * const pxTimer,
+                                                      const BaseType_t xCommandID,
+                                                      const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a fast timer into the current or overflow fast timer list, depending
+ * on whether xNextExpiryTime is before or after the tick count next overflows.
+ * A timer that has already expired is inserted so it expires on the next tick.
+ * Must be called from within a critical section.
+ */
+        static void prvInsertFastTimer( Timer_t * const pxTimer,
+                                        const TickType_t xNextExpiryTime,
+                                        const TickType_t xTimeNow,
+                                        const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove the fast timer at the head of the current fast timer list, which has
+ * expired, restart it if it is an auto-reload timer, then call its callback.
+ */
+        static void prvProcessExpiredFastTimer( void ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_FAST_TIMERS */
 /*-----------------------------------------------------------*/
 
     BaseType_t xTimerCreateTimerTask( void )
     {
-        BaseType_t xReturn = pdFAIL;
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxService;
+        TimerService_t * pxService;
 
         /* This function is called when the scheduler is started if
          * configUSE_TIMERS is set to 1.  Check that the infrastructure used by the
-         * timer service task has been created/initialised.  If timers have already
+         * timer service tasks has been created/initialised.  If timers have already
          * been created then the initialisation will already have been performed. */
         prvCheckForValidListAndQueue();
 
-        if( xTimerQueue != NULL )
+        /* Create a task for each timer service.  The task is passed its timer
+         * service as its parameter. */
+        for( uxService = ( UBaseType_t ) 0U; ( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT ) && ( xReturn != pdFAIL ); uxService++ )
         {
-            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
-                {
-                    StaticTask_t * pxTimerTaskTCBBuffer = NULL;
-                    StackType_t * pxTimerTaskStackBuffer = NULL;
-                    uint32_t ulTimerTaskStackSize;
-
-                    vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
-                    xTimerTaskHandle = xTaskCreateStatic( prvTimerTask,
-                                                          configTIMER_SERVICE_TASK_NAME,
-                                                          ulTimerTaskStackSize,
-                                                          NULL,
-                                                          ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-                                                          pxTimerTaskStackBuffer,
-                                                          pxTimerTaskTCBBuffer );
-
-                    if( xTimerTaskHandle != NULL )
+            pxService = &( xTimerServices[ uxService ] );
+            xReturn = pdFAIL;
+
+            if( pxService->xTimerQueue != NULL )
+            {
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                     {
-                        xReturn = pdPASS;
+                        StaticTask_t * pxTimerTaskTCBBuffer = NULL;
+                        StackType_t * pxTimerTaskStackBuffer = NULL;
+                        uint32_t ulTimerTaskStackSize;
+
+                        #if ( configTIMER_SERVICE_COUNT > 1 )
+                            {
+                                /* The application provides the memory for the task of
+                                 * timer service 0 only.  The tasks of the other timer
+                                 * services are allocated statically here in case
+                                 * configSUPPORT_DYNAMIC_ALLOCATION is 0. */
+                                PRIVILEGED_DATA static StaticTask_t xStaticServiceTaskTCBs[ configTIMER_SERVICE_COUNT - 1 ];                                     /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+                                PRIVILEGED_DATA static StackType_t xStaticServiceTaskStacks[ configTIMER_SERVICE_COUNT - 1 ][ configTIMER_TASK_STACK_DEPTH ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+
+                                if( uxService != ( UBaseType_t ) 0U )
+                                {
+                                    pxTimerTaskTCBBuffer = &( xStaticServiceTaskTCBs[ uxService - 1U ] );
+                                    pxTimerTaskStackBuffer = &( xStaticServiceTaskStacks[ uxService - 1U ][ 0 ] );
+                                    ulTimerTaskStackSize = ( uint32_t ) configTIMER_TASK_STACK_DEPTH;
+                                }
+                                else
+                                {
+                                    vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
+                                }
+                            }
+                        #else /* if ( configTIMER_SERVICE_COUNT > 1 ) */
+                            {
+                                vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
+                            }
+                        #endif /* configTIMER_SERVICE_COUNT */
+
+                        pxService->xTimerTaskHandle = xTaskCreateStatic( prvTimerTask,
+                                                                         configTIMER_SERVICE_TASK_NAME,
+                                                                         ulTimerTaskStackSize,
+                                                                         ( void * ) pxService,
+                                                                         tmrSERVICE_TASK_PRIORITY( uxService ) | portPRIVILEGE_BIT,
+                                                                         pxTimerTaskStackBuffer,
+                                                                         pxTimerTaskTCBBuffer );
+
+                        if( pxService->xTimerTaskHandle != NULL )
+                        {
+                            xReturn = pdPASS;
+                        }
                     }
-                }
-            #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
-                {
-                    xReturn = xTaskCreate( prvTimerTask,
-                                           configTIMER_SERVICE_TASK_NAME,
-                                           configTIMER_TASK_STACK_DEPTH,
-                                           NULL,
-                                           ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-                                           &xTimerTaskHandle );
-                }
-            #endif /* configSUPPORT_STATIC_ALLOCATION */
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+                #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+                    {
+                        xReturn = xTaskCreate( prvTimerTask,
+                                               configTIMER_SERVICE_TASK_NAME,
+                                               configTIMER_TASK_STACK_DEPTH,
+                                               ( void * ) pxService,
+                                               tmrSERVICE_TASK_PRIORITY( uxService ) | portPRIVILEGE_BIT,
+                                               &( pxService->xTimerTaskHandle ) );
+                    }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
 
         configASSERT( xReturn );
@@ -340,6 +531,114 @@
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_FAST_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        TimerHandle_t xTimerCreateFast( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                        const TickType_t xTimerPeriodInTicks,
+                                        const UBaseType_t uxAutoReload,
+                                        void * const pvTimerID,
+                                        TimerCallbackFunction_t pxCallbackFunction )
+        {
+            Timer_t * pxNewTimer;
+
+            pxNewTimer = xTimerCreate( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction );
+
+            if( pxNewTimer != NULL )
+            {
+                /* No other task has the handle yet, so the status can be
+                 * updated without a critical section. */
+                pxNewTimer->ucStatus |= tmrSTATUS_IS_FAST;
+            }
+
+            return pxNewTimer;
+        }
+
+    #endif /* ( configUSE_FAST_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAST_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        TimerHandle_t xTimerCreateFastStatic( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                              const TickType_t xTimerPeriodInTicks,
+                                              const UBaseType_t uxAutoReload,
+                                              void * const pvTimerID,
+                                              TimerCallbackFunction_t pxCallbackFunction,
+                                              StaticTimer_t * pxTimerBuffer )
+        {
+            Timer_t * pxNewTimer;
+
+            pxNewTimer = xTimerCreateStatic( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer );
+
+            if( pxNewTimer != NULL )
+            {
+                /* No other task has the handle yet, so the status can be
+                 * updated without a critical section. */
+                pxNewTimer->ucStatus |= tmrSTATUS_IS_FAST;
+            }
+
+            return pxNewTimer;
+        }
+
+    #endif /* ( configUSE_FAST_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        TimerHandle_t xTimerCreateOnService( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                             const TickType_t xTimerPeriodInTicks,
+                                             const UBaseType_t uxAutoReload,
+                                             void * const pvTimerID,
+                                             TimerCallbackFunction_t pxCallbackFunction,
+                                             const UBaseType_t uxService )
+        {
+            Timer_t * pxNewTimer;
+
+            configASSERT( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT );
+
+            pxNewTimer = xTimerCreate( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction );
+
+            if( pxNewTimer != NULL )
+            {
+                /* No other task has the handle yet, so the timer service can be
+                 * set without a critical section. */
+                pxNewTimer->pxService = &( xTimerServices[ uxService ] );
+            }
+
+            return pxNewTimer;
+        }
+
+    #endif /* ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        TimerHandle_t xTimerCreateStaticOnService( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                                   const TickType_t xTimerPeriodInTicks,
+                                                   const UBaseType_t uxAutoReload,
+                                                   void * const pvTimerID,
+                                                   TimerCallbackFunction_t pxCallbackFunction,
+                                                   StaticTimer_t * pxTimerBuffer,
+                                                   const UBaseType_t uxService )
+        {
+            Timer_t * pxNewTimer;
+
+            configASSERT( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT );
+
+            pxNewTimer = xTimerCreateStatic( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer );
+
+            if( pxNewTimer != NULL )
+            {
+                /* No other task has the handle yet, so the timer service can be
+                 * set without a critical section. */
+                pxNewTimer->pxService = &( xTimerServices[ uxService ] );
+            }
+
+            return pxNewTimer;
+        }
+
+    #endif /* ( configTIMER_SERVICE_COUNT > 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
     static void prvInitialiseNewTimer( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
                                        const TickType_t xTimerPeriodInTicks,
                                        const UBaseType_t uxAutoReload,
@@ -364,72 +663,526 @@
             pxNewTimer->pxCallbackFunction = pxCallbackFunction;
             vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
+            #if ( configTIMER_SERVICE_COUNT > 1 )
+                {
+                    /* Timers are managed by timer service 0 unless they are
+                     * created with xTimerCreateOnService(). */
+                    pxNewTimer->pxService = &( xTimerServices[ 0 ] );
+                }
+            #endif
+
             if( uxAutoReload != pdFALSE )
             {
                 pxNewTimer->ucStatus |= tmrSTATUS_IS_AUTORELOAD;
             }
-
-            traceTIMER_CREATE( pxNewTimer );
+
+            traceTIMER_CREATE( pxNewTimer );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerGenericCommand( TimerHandle_t xTimer,
+                                     const BaseType_t xCommandID,
+                                     const TickType_t xOptionalValue,
+                                     BaseType_t * const pxHigherPriorityTaskWoken,
+                                     const TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        DaemonTaskMessage_t xMessage;
+        TimerService_t * pxService;
+
+        configASSERT( xTimer );
+        pxService = tmrGET_SERVICE( xTimer );
+
+        #if ( configUSE_FAST_TIMERS == 1 )
+            {
+                /* Commands for fast timers are never sent to the timer service
+                 * task.  The status bit is only written when the timer is
+                 * created, so can be read without a critical section. */
+                if( ( xTimer->ucStatus & tmrSTATUS_IS_FAST ) != ( uint8_t ) 0 )
+                {
+                    xReturn = prvProcessFastTimerCommand( xTimer, xCommandID, xOptionalValue );
+                    traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+
+                    return xReturn;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_FAST_TIMERS */
+
+        /* Send a message to the task of the timer's timer service to perform a
+         * particular action on a particular timer definition. */
+        if( pxService->xTimerQueue != NULL )
+        {
+            /* Send a command to the timer service task to start the xTimer timer. */
+            xMessage.xMessageID = xCommandID;
+            xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
+            xMessage.u.xTimerParameters.pxTimer = xTimer;
+
+            if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+            {
+                if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+                {
+                    #if ( configTIMER_DIRECT_COMMANDS == 1 )
+                        {
+                            xReturn = prvProcessCommandDirectly( xTimer, xCommandID, xOptionalValue );
+
+                            if( xReturn == pdFAIL )
+                            {
+                                xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, xTicksToWait );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #else
+                        {
+                            xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, xTicksToWait );
+                        }
+                    #endif
+                }
+                else
+                {
+                    xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, tmrNO_DELAY );
+                }
+            }
+            else
+            {
+                xReturn = xQueueSendToBackFromISR( pxService->xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+            }
+
+            traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_DIRECT_COMMANDS == 1 )
+
+        static BaseType_t prvProcessCommandDirectly( Timer_t * const pxTimer,
+                                                     const BaseType_t xCommandID,
+                                                     const TickType_t xOptionalValue )
+        {
+            TimerService_t * const pxService = tmrGET_SERVICE( pxTimer );
+            BaseType_t xReturn = pdFAIL;
+            BaseType_t xListWasEmpty, xOverflowListWasEmpty, xListIsEmpty, xTimerHasExpired;
+            TickType_t xTimeNow, xNextExpireTime, xNewNextExpireTime;
+            DaemonTaskMessage_t xMessage;
+
+            /* Deleting a timer frees its memory, so is always left to the timer
+             * service task, as are the commands it sends to itself. */
+            if( ( xCommandID >= tmrCOMMAND_START ) && ( xCommandID <= tmrCOMMAND_CHANGE_PERIOD ) )
+            {
+                vTaskSuspendAll();
+                {
+                    /* The tick count cannot change while the scheduler is
+                     * suspended.  Send the command to the timer service task
+                     * instead if the tick count has overflowed but the timer
+                     * service task has not yet switched the lists, or if there
+                     * are commands waiting that must be processed first to keep
+                     * all the commands in order. */
+                    xTimeNow = xTaskGetTickCount();
+
+                    /* If the timer has already expired its callback must be
+                     * called by the timer service task, so the command is sent
+                     * on to it.  This is decided before the timer is removed
+                     * from its list, so the timer is left untouched if sending
+                     * the command then fails.  The test matches the one in
+                     * prvInsertTimerInActiveList(). */
+                    if( ( ( xCommandID == tmrCOMMAND_START ) || ( xCommandID == tmrCOMMAND_RESET ) ) &&
+                        ( ( ( TickType_t ) ( xTimeNow - xOptionalValue ) ) >= pxTimer->xTimerPeriodInTicks ) ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    {
+                        xTimerHasExpired = pdTRUE;
+                    }
+                    else
+                    {
+                        xTimerHasExpired = pdFALSE;
+                    }
+
+                    if( ( xTimeNow >= pxService->xLastTime ) && ( uxQueueMessagesWaiting( pxService->xTimerQueue ) == ( UBaseType_t ) 0U ) && ( xTimerHasExpired == pdFALSE ) )
+                    {
+                        xNextExpireTime = prvGetNextExpireTime( pxService, &xListWasEmpty );
+                        xOverflowListWasEmpty = listLIST_IS_EMPTY( pxService->pxOverflowTimerList );
+
+                        if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+                        {
+                            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        /* The commands are applied as in prvProcessReceivedCommands(). */
+                        switch( xCommandID )
+                        {
+                            case tmrCOMMAND_START:
+                            case tmrCOMMAND_RESET:
+                                pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+
+                                /* The timer is known not to have expired, so is
+                                 * always inserted into a list. */
+                                ( void ) prvInsertTimerInActiveList( pxTimer, xOptionalValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xOptionalValue );
+                                xReturn = pdPASS;
+                                break;
+
+                            case tmrCOMMAND_STOP:
+                                pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+                                xReturn = pdPASS;
+                                break;
+
+                            case tmrCOMMAND_CHANGE_PERIOD:
+                                pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+                                pxTimer->xTimerPeriodInTicks = xOptionalValue;
+                                configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+                                ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+                                xReturn = pdPASS;
+                                break;
+
+                            default:
+                                /* Don't expect to get here. */
+                                break;
+                        }
+
+                        if( xReturn != pdFAIL )
+                        {
+                            /* The timer service task is blocked until the next
+                             * expire time, or until the tick count overflows if
+                             * the current list was empty, or indefinitely if both
+                             * lists were empty.  Only wake it if that is now too
+                             * late. */
+                            xNewNextExpireTime = prvGetNextExpireTime( pxService, &xListIsEmpty );
+
+                            if( ( ( xListIsEmpty == pdFALSE ) && ( ( xListWasEmpty != pdFALSE ) || ( xNewNextExpireTime < xNextExpireTime ) ) ) ||
+                                ( ( xListWasEmpty != pdFALSE ) && ( xOverflowListWasEmpty != pdFALSE ) && ( listLIST_IS_EMPTY( pxService->pxOverflowTimerList ) == pdFALSE ) ) )
+                            {
+                                xMessage.xMessageID = tmrCOMMAND_WAKE_DAEMON;
+                                xMessage.u.xTimerParameters.xMessageValue = ( TickType_t ) 0U;
+                                xMessage.u.xTimerParameters.pxTimer = NULL;
+
+                                /* If the queue is full the timer service task
+                                 * will run anyway. */
+                                ( void ) xQueueSendToBack( pxService->xTimerQueue, &xMessage, tmrNO_DELAY );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configTIMER_DIRECT_COMMANDS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAST_TIMERS == 1 )
+
+        static BaseType_t prvProcessFastTimerCommand( Timer_t * const pxTimer,
+                                                      const BaseType_t xCommandID,
+                                                      const TickType_t xOptionalValue )
+        {
+            BaseType_t xReturn = pdPASS;
+            BaseType_t xFreeTimer = pdFALSE;
+            UBaseType_t uxSavedInterruptStatus = ( UBaseType_t ) 0U;
+            TickType_t xTimeNow;
+
+            /* The fast timer lists are accessed from the tick interrupt. */
+            if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+            {
+                taskENTER_CRITICAL();
+                xTimeNow = xTaskGetTickCount();
+            }
+            else
+            {
+                uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                xTimeNow = xTaskGetTickCountFromISR();
+            }
+
+            {
+                if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+                {
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The commands are applied as in prvProcessReceivedCommands(),
+                 * except that a timer that has already expired is left for the
+                 * next tick interrupt to process. */
+                switch( xCommandID )
+                {
+                    case tmrCOMMAND_START:
+                    case tmrCOMMAND_START_FROM_ISR:
+                    case tmrCOMMAND_RESET:
+                    case tmrCOMMAND_RESET_FROM_ISR:
+                        /* xOptionalValue is the tick count when the command
+                         * was issued. */
+                        pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+                        prvInsertFastTimer( pxTimer, xOptionalValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xOptionalValue );
+                        break;
+
+                    case tmrCOMMAND_STOP:
+                    case tmrCOMMAND_STOP_FROM_ISR:
+                        pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+                        break;
+
+                    case tmrCOMMAND_CHANGE_PERIOD:
+                    case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                        pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+                        pxTimer->xTimerPeriodInTicks = xOptionalValue;
+                        configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+                        prvInsertFastTimer( pxTimer, xTimeNow + pxTimer->xTimerPeriodInTicks, xTimeNow, xTimeNow );
+                        break;
+
+                    case tmrCOMMAND_DELETE:
+                        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                            {
+                                /* The memory is freed outside of the critical
+                                 * section. */
+                                if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+                                {
+                                    xFreeTimer = pdTRUE;
+                                }
+                                else
+                                {
+                                    pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+                                }
+                            }
+                        #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+                            {
+                                pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+                            }
+                        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+                        break;
+
+                    default:
+                        xReturn = pdFAIL;
+                        break;
+                }
+            }
+
+            if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+            {
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+            }
+
+            if( xFreeTimer != pdFALSE )
+            {
+                vPortFree( pxTimer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_FAST_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAST_TIMERS == 1 )
+
+        static void prvInsertFastTimer( Timer_t * const pxTimer,
+                                        const TickType_t xNextExpiryTime,
+                                        const TickType_t xTimeNow,
+                                        const TickType_t xCommandTime )
+        {
+            List_t * pxList = pxCurrentFastTimerList;
+            TickType_t xItemValue = xNextExpiryTime;
+
+            /* The expiry time is checked in the same way as in
+             * prvInsertTimerInActiveList().  A timer that has already expired is
+             * given the current time as its expiry time, so it is at the front
+             * of the current list and is processed by the next tick. */
+            if( xNextExpiryTime <= xTimeNow )
+            {
+                if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                {
+                    xItemValue = xTimeNow;
+                }
+                else
+                {
+                    pxList = pxOverflowFastTimerList;
+                }
+            }
+            else if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+            {
+                /* The tick count has overflowed since the command was issued,
+                 * but the expiry time has not. */
+                xItemValue = xTimeNow;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xItemValue );
+            listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+            vListInsert( pxList, &( pxTimer->xTimerListItem ) );
+        }
+
+    #endif /* configUSE_FAST_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAST_TIMERS == 1 )
+
+        static void prvProcessExpiredFastTimer( void )
+        {
+            Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentFastTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+            TickType_t xNextExpiryTime;
+
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+            traceTIMER_EXPIRED( pxTimer );
+
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+            {
+                /* The next expiry time is calculated from the expiry time, not
+                 * the tick count, so the period does not drift.  If it has
+                 * overflowed it is reached after the lists are switched. */
+                xNextExpiryTime = xExpiryTime + pxTimer->xTimerPeriodInTicks;
+                listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+
+                if( xNextExpiryTime < xExpiryTime )
+                {
+                    vListInsert( pxOverflowFastTimerList, &( pxTimer->xTimerListItem ) );
+                }
+                else
+                {
+                    vListInsert( pxCurrentFastTimerList, &( pxTimer->xTimerListItem ) );
+                }
+            }
+            else
+            {
+                pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+            }
+
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+        }
+
+    #endif /* configUSE_FAST_TIMERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAST_TIMERS == 1 )
+
+        void vTimerProcessFastTimers( const TickType_t xTickCount )
+        {
+            List_t * pxTemp;
+
+            /* Called from the tick interrupt, or with interrupts masked when
+             * pended ticks are processed, so the lists can be accessed without
+             * a further critical section. */
+            if( xTickCount == ( TickType_t ) 0U )
+            {
+                /* The tick count has overflowed, so any timers remaining in
+                 * the current list have expired.  Auto-reload timers whose next
+                 * expiry time has not overflowed are put back into the current
+                 * list, so are processed again before the lists are switched. */
+                while( listLIST_IS_EMPTY( pxCurrentFastTimerList ) == pdFALSE )
+                {
+                    prvProcessExpiredFastTimer();
+                }
+
+                pxTemp = pxCurrentFastTimerList;
+                pxCurrentFastTimerList = pxOverflowFastTimerList;
+                pxOverflowFastTimerList = pxTemp;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            while( ( listLIST_IS_EMPTY( pxCurrentFastTimerList ) == pdFALSE ) &&
+                   ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentFastTimerList ) <= xTickCount ) )
+            {
+                prvProcessExpiredFastTimer();
+            }
         }
-    }
-/*-----------------------------------------------------------*/
 
-    BaseType_t xTimerGenericCommand( TimerHandle_t xTimer,
-                                     const BaseType_t xCommandID,
-                                     const TickType_t xOptionalValue,
-                                     BaseType_t * const pxHigherPriorityTaskWoken,
-                                     const TickType_t xTicksToWait )
-    {
-        BaseType_t xReturn = pdFAIL;
-        DaemonTaskMessage_t xMessage;
+    #endif /* configUSE_FAST_TIMERS */
+/*-----------------------------------------------------------*/
 
-        configASSERT( xTimer );
+    #if ( configUSE_FAST_TIMERS == 1 )
 
-        /* Send a message to the timer service task to perform a particular action
-         * on a particular timer definition. */
-        if( xTimerQueue != NULL )
+        TickType_t xTimerGetNextFastExpireTime( void )
         {
-            /* Send a command to the timer service task to start the xTimer timer. */
-            xMessage.xMessageID = xCommandID;
-            xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
-            xMessage.u.xTimerParameters.pxTimer = xTimer;
+            TickType_t xReturn;
 
-            if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+            taskENTER_CRITICAL();
             {
-                if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+                if( listLIST_IS_EMPTY( pxCurrentFastTimerList ) == pdFALSE )
                 {
-                    xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+                    xReturn = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentFastTimerList );
                 }
                 else
                 {
-                    xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+                    xReturn = portMAX_DELAY;
                 }
             }
-            else
-            {
-                xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
-            }
+            taskEXIT_CRITICAL();
 
-            traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+            return xReturn;
         }
 
-        return xReturn;
-    }
+    #endif /* configUSE_FAST_TIMERS */
 /*-----------------------------------------------------------*/
 
     TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
     {
         /* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
          * started, then xTimerTaskHandle will be NULL. */
-        configASSERT( ( xTimerTaskHandle != NULL ) );
-        return xTimerTaskHandle;
+        configASSERT( ( xTimerServices[ 0 ].xTimerTaskHandle != NULL ) );
+        return xTimerServices[ 0 ].xTimerTaskHandle;
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configTIMER_SERVICE_COUNT > 1 )
+
+        TaskHandle_t xTimerGetServiceTaskHandle( const UBaseType_t uxService )
+        {
+            configASSERT( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT );
+
+            /* The handle is NULL until the scheduler has been started. */
+            configASSERT( ( xTimerServices[ uxService ].xTimerTaskHandle != NULL ) );
+            return xTimerServices[ uxService ].xTimerTaskHandle;
+        }
+
+    #endif /* configTIMER_SERVICE_COUNT */
+/*-----------------------------------------------------------*/
+
     TickType_t xTimerGetPeriod( TimerHandle_t xTimer )
     {
         Timer_t * pxTimer = xTimer;
@@ -505,11 +1258,18 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
-                                        const TickType_t xTimeNow )
+    static Timer_t * prvProcessExpiredTimer( TimerService_t * const pxService,
+                                             const TickType_t xNextExpireTime,
+                                             const TickType_t xTimeNow )
     {
         BaseType_t xResult;
-        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        #if ( configTIMER_USE_WHEEL == 1 )
+            List_t * const pxExpiredTimerList = &( pxService->xTimerWheel[ 0 ][ xNextExpireTime & tmrWHEEL_SLOT_MASK ] );
+        #else
+            List_t * const pxExpiredTimerList = pxService->pxCurrentTimerList;
+        #endif
+        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxExpiredTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
         /* Remove the timer from the list of active timers.  A check has already
          * been performed to ensure the list is not empty. */
@@ -543,18 +1303,13 @@
             mtCOVERAGE_TEST_MARKER();
         }
 
-        /* Call the timer callback. */
-        pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+        return pxTimer;
     }
 /*-----------------------------------------------------------*/
 
     static portTASK_FUNCTION( prvTimerTask, pvParameters )
     {
-        TickType_t xNextExpireTime;
-        BaseType_t xListWasEmpty;
-
-        /* Just to avoid compiler warnings. */
-        ( void ) pvParameters;
+        TimerService_t * const pxService = ( TimerService_t * ) pvParameters;
 
         #if ( configUSE_DAEMON_TASK_STARTUP_HOOK == 1 )
             {
@@ -563,49 +1318,88 @@
                 /* Allow the application writer to execute some code in the context of
                  * this task at the point the task starts executing.  This is useful if the
                  * application includes initialisation code that would benefit from
-                 * executing after the scheduler has been started. */
-                vApplicationDaemonTaskStartupHook();
+                 * executing after the scheduler has been started.  Only the task of
+                 * timer service 0 calls the hook. */
+                if( pxService == &( xTimerServices[ 0 ] ) )
+                {
+                    vApplicationDaemonTaskStartupHook();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
         #endif /* configUSE_DAEMON_TASK_STARTUP_HOOK */
 
         for( ; ; )
         {
-            /* Query the timers list to see if it contains any timers, and if so,
-             * obtain the time at which the next timer will expire. */
-            xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
-
             /* If a timer has expired, process it.  Otherwise, block this task
              * until either a timer does expire, or a command is received. */
-            prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+            prvProcessTimerOrBlockTask( pxService );
 
             /* Empty the command queue. */
-            prvProcessReceivedCommands();
+            prvProcessReceivedCommands( pxService );
         }
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
-                                            BaseType_t xListWasEmpty )
+    static void prvProcessTimerOrBlockTask( TimerService_t * const pxService )
     {
-        TickType_t xTimeNow;
-        BaseType_t xTimerListsWereSwitched;
+        TickType_t xNextExpireTime, xTimeNow;
+        BaseType_t xListWasEmpty, xTimerListsWereSwitched;
+        Timer_t * pxExpiredTimer = NULL;
 
         vTaskSuspendAll();
         {
+            /* Query the timers list to see if it contains any timers, and if so,
+             * obtain the time at which the next timer will expire.  The lists are
+             * only accessed with the scheduler suspended, as other tasks update
+             * them too when configTIMER_DIRECT_COMMANDS is 1. */
+            xNextExpireTime = prvGetNextExpireTime( pxService, &xListWasEmpty );
+
             /* Obtain the time now to make an assessment as to whether the timer
              * has expired or not.  If obtaining the time causes the lists to switch
              * then don't process this timer as any timers that remained in the list
              * when the lists were switched will have been processed within the
              * prvSampleTimeNow() function. */
-            xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+            xTimeNow = prvSampleTimeNow( pxService, &xTimerListsWereSwitched );
 
             if( xTimerListsWereSwitched == pdFALSE )
             {
                 /* The tick count has not overflowed, has the timer expired? */
                 if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
                 {
+                    #if ( configTIMER_USE_WHEEL == 1 )
+                        {
+                            /* Move the wheel on to the next expire time.  That
+                             * might only move timers down to a lower level of the
+                             * wheel, in which case no timer has expired yet. */
+                            if( prvWheelAdvance( pxService, xNextExpireTime ) != pdFALSE )
+                            {
+                                pxExpiredTimer = prvProcessExpiredTimer( pxService, xNextExpireTime, xTimeNow );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #else
+                        {
+                            pxExpiredTimer = prvProcessExpiredTimer( pxService, xNextExpireTime, xTimeNow );
+                        }
+                    #endif /* configTIMER_USE_WHEEL */
+
                     ( void ) xTaskResumeAll();
-                    prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+
+                    if( pxExpiredTimer != NULL )
+                    {
+                        /* Call the timer callback. */
+                        pxExpiredTimer->pxCallbackFunction( ( TimerHandle_t ) pxExpiredTimer );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
@@ -619,10 +1413,10 @@
                     {
                         /* The current timer list is empty - is the overflow list
                          * also empty? */
-                        xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        xListWasEmpty = listLIST_IS_EMPTY( pxService->pxOverflowTimerList );
                     }
 
-                    vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+                    vQueueWaitForMessageRestricted( pxService->xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
 
                     if( xTaskResumeAll() == pdFALSE )
                     {
@@ -646,43 +1440,54 @@
     }
 /*-----------------------------------------------------------*/
 
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+    static TickType_t prvGetNextExpireTime( TimerService_t * const pxService,
+                                            BaseType_t * const pxListWasEmpty )
     {
         TickType_t xNextExpireTime;
 
-        /* Timers are listed in expiry time order, with the head of the list
-         * referencing the task that will expire first.  Obtain the time at which
-         * the timer with the nearest expiry time will expire.  If there are no
-         * active timers then just set the next expire time to 0.  That will cause
-         * this task to unblock when the tick count overflows, at which point the
-         * timer lists will be switched and the next expiry time can be
-         * re-assessed.  */
-        *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-
-        if( *pxListWasEmpty == pdFALSE )
-        {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-        }
-        else
-        {
-            /* Ensure the task unblocks when the tick count rolls over. */
-            xNextExpireTime = ( TickType_t ) 0U;
-        }
+        #if ( configTIMER_USE_WHEEL == 1 )
+            {
+                /* The wheel returns 0 when it is empty for the same reason as
+                 * the list version below. */
+                xNextExpireTime = prvWheelGetNextEvent( pxService, pxListWasEmpty );
+            }
+        #else /* if ( configTIMER_USE_WHEEL == 1 ) */
+            {
+                /* Timers are listed in expiry time order, with the head of the list
+                 * referencing the task that will expire first.  Obtain the time at which
+                 * the timer with the nearest expiry time will expire.  If there are no
+                 * active timers then just set the next expire time to 0.  That will cause
+                 * this task to unblock when the tick count overflows, at which point the
+                 * timer lists will be switched and the next expiry time can be
+                 * re-assessed.  */
+                *pxListWasEmpty = listLIST_IS_EMPTY( pxService->pxCurrentTimerList );
+
+                if( *pxListWasEmpty == pdFALSE )
+                {
+                    xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+                }
+                else
+                {
+                    /* Ensure the task unblocks when the tick count rolls over. */
+                    xNextExpireTime = ( TickType_t ) 0U;
+                }
+            }
+        #endif /* configTIMER_USE_WHEEL */
 
         return xNextExpireTime;
     }
 /*-----------------------------------------------------------*/
 
-    static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+    static TickType_t prvSampleTimeNow( TimerService_t * const pxService,
+                                        BaseType_t * const pxTimerListsWereSwitched )
     {
         TickType_t xTimeNow;
-        PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
 
         xTimeNow = xTaskGetTickCount();
 
-        if( xTimeNow < xLastTime )
+        if( xTimeNow < pxService->xLastTime )
         {
-            prvSwitchTimerLists();
+            prvSwitchTimerLists( pxService );
             *pxTimerListsWereSwitched = pdTRUE;
         }
         else
@@ -690,7 +1495,7 @@
             *pxTimerListsWereSwitched = pdFALSE;
         }
 
-        xLastTime = xTimeNow;
+        pxService->xLastTime = xTimeNow;
 
         return xTimeNow;
     }
@@ -701,6 +1506,7 @@
                                                   const TickType_t xTimeNow,
                                                   const TickType_t xCommandTime )
     {
+        TimerService_t * const pxService = tmrGET_SERVICE( pxTimer );
         BaseType_t xProcessTimerNow = pdFALSE;
 
         listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
@@ -718,7 +1524,17 @@
             }
             else
             {
-                vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                #if ( configTIMER_USE_WHEEL == 1 )
+                    {
+                        /* The overflow list is only walked when the tick count
+                         * overflows, so does not need to be kept in order. */
+                        vListInsertEnd( pxService->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                    }
+                #else
+                    {
+                        vListInsert( pxService->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                    }
+                #endif
             }
         }
         else
@@ -732,7 +1548,15 @@
             }
             else
             {
-                vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                #if ( configTIMER_USE_WHEEL == 1 )
+                    {
+                        prvWheelInsertTimer( pxService, pxTimer );
+                    }
+                #else
+                    {
+                        vListInsert( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                    }
+                #endif
             }
         }
 
@@ -740,20 +1564,171 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessReceivedCommands( void )
+    #if ( configTIMER_USE_WHEEL == 1 )
+
+        static void prvWheelInsertTimer( TimerService_t * const pxService,
+                                         Timer_t * const pxTimer )
+        {
+            const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+            TickType_t xDifference = xExpiryTime ^ pxService->xTimerWheelTime;
+            UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxSlot;
+
+            configASSERT( xExpiryTime >= pxService->xTimerWheelTime );
+
+            /* Find the highest level at which the expiry time differs from the
+             * wheel time.  The timer's slot at that level comes from the expiry
+             * time's bits for that level. */
+            while( ( xDifference >> tmrWHEEL_SLOT_BITS ) != ( TickType_t ) 0U )
+            {
+                xDifference >>= tmrWHEEL_SLOT_BITS;
+                uxLevel++;
+            }
+
+            uxSlot = ( UBaseType_t ) ( ( xExpiryTime >> ( uxLevel * tmrWHEEL_SLOT_BITS ) ) & tmrWHEEL_SLOT_MASK );
+
+            /* All the timers in a level 0 slot expire at the same time, and the
+             * timers in higher level slots are moved down before they expire, so
+             * no slot needs to be kept in order. */
+            vListInsertEnd( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+            pxService->ulTimerWheelSlotsInUse[ uxLevel ] |= ( 1UL << uxSlot );
+        }
+
+    #endif /* configTIMER_USE_WHEEL */
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_USE_WHEEL == 1 )
+
+        static TickType_t prvWheelGetNextEvent( TimerService_t * const pxService,
+                                                BaseType_t * const pxWheelWasEmpty )
+        {
+            TickType_t xNextEvent = ( TickType_t ) 0U;
+            UBaseType_t uxLevel, uxSlot, uxShift;
+            uint32_t ulSlotsInUse;
+
+            *pxWheelWasEmpty = pdTRUE;
+
+            /* Every slot of a level is later than every slot that is still to be
+             * reached in the levels below it, so the first slot in use, searching
+             * from the lowest level up, holds the next event. */
+            for( uxLevel = ( UBaseType_t ) 0U; ( uxLevel < ( UBaseType_t ) tmrWHEEL_LEVELS ) && ( *pxWheelWasEmpty != pdFALSE ); uxLevel++ )
+            {
+                uxShift = uxLevel * tmrWHEEL_SLOT_BITS;
+                uxSlot = ( UBaseType_t ) ( ( pxService->xTimerWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK );
+
+                /* The level 0 slot the wheel time is in holds timers that expire
+                 * at the wheel time.  In the higher levels that slot, and the
+                 * slots before it, are always empty. */
+                if( uxLevel != ( UBaseType_t ) 0U )
+                {
+                    uxSlot++;
+                }
+
+                ulSlotsInUse = pxService->ulTimerWheelSlotsInUse[ uxLevel ] >> uxSlot;
+
+                while( ulSlotsInUse != 0UL )
+                {
+                    if( ( ulSlotsInUse & 1UL ) != 0UL )
+                    {
+                        if( listLIST_IS_EMPTY( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ) ) == pdFALSE )
+                        {
+                            /* The event is at the start of the slot - the wheel
+                             * time's bits for the levels above this one, the slot
+                             * number for this level, and zero below. */
+                            xNextEvent = pxService->xTimerWheelTime & ~( ( tmrWHEEL_SLOT_MASK << uxShift ) | ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U ) );
+                            xNextEvent |= ( ( TickType_t ) uxSlot ) << uxShift;
+                            *pxWheelWasEmpty = pdFALSE;
+                            break;
+                        }
+                        else
+                        {
+                            /* All the timers in the slot were removed since the
+                             * bit was set. */
+                            pxService->ulTimerWheelSlotsInUse[ uxLevel ] &= ~( 1UL << uxSlot );
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ulSlotsInUse >>= 1;
+                    uxSlot++;
+                }
+            }
+
+            return xNextEvent;
+        }
+
+    #endif /* configTIMER_USE_WHEEL */
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_USE_WHEEL == 1 )
+
+        static BaseType_t prvWheelAdvance( TimerService_t * const pxService,
+                                           const TickType_t xTime )
+        {
+            TickType_t xDifference = xTime ^ pxService->xTimerWheelTime;
+            UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxSlot;
+            List_t * pxSlot;
+            Timer_t * pxTimer;
+
+            configASSERT( xTime >= pxService->xTimerWheelTime );
+
+            while( ( xDifference >> tmrWHEEL_SLOT_BITS ) != ( TickType_t ) 0U )
+            {
+                xDifference >>= tmrWHEEL_SLOT_BITS;
+                uxLevel++;
+            }
+
+            pxService->xTimerWheelTime = xTime;
+
+            /* xTime is no later than the next event, so the only timers that are
+             * no longer in the right level are those in the level uxLevel slot
+             * that xTime has just reached.  They now differ from the wheel time
+             * only in lower levels, so move them down. */
+            if( uxLevel != ( UBaseType_t ) 0U )
+            {
+                uxSlot = ( UBaseType_t ) ( ( xTime >> ( uxLevel * tmrWHEEL_SLOT_BITS ) ) & tmrWHEEL_SLOT_MASK );
+                pxSlot = &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] );
+
+                while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+                {
+                    pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                    prvWheelInsertTimer( pxService, pxTimer );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return ( listLIST_IS_EMPTY( &( pxService->xTimerWheel[ 0 ][ xTime & tmrWHEEL_SLOT_MASK ] ) ) == pdFALSE ) ? pdTRUE : pdFALSE;
+        }
+
+    #endif /* configTIMER_USE_WHEEL */
+/*-----------------------------------------------------------*/
+
+    static void prvProcessReceivedCommands( TimerService_t * const pxService )
     {
         DaemonTaskMessage_t xMessage;
         Timer_t * pxTimer;
         BaseType_t xTimerListsWereSwitched, xResult;
         TickType_t xTimeNow;
 
-        while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+        /* Commands are received with the list access held so a task cannot
+         * apply a later command directly before an earlier one has been
+         * processed.  Callbacks are always called without it. */
+        tmrENTER_LIST_ACCESS();
+
+        while( xQueueReceive( pxService->xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
         {
             #if ( INCLUDE_xTimerPendFunctionCall == 1 )
                 {
                     /* Negative commands are pended function calls rather than timer
-                     * commands. */
-                    if( xMessage.xMessageID < ( BaseType_t ) 0 )
+                     * commands, except for tmrCOMMAND_WAKE_DAEMON, which only
+                     * has to unblock this task. */
+                    if( ( xMessage.xMessageID < ( BaseType_t ) 0 ) && ( xMessage.xMessageID != tmrCOMMAND_WAKE_DAEMON ) )
                     {
                         const CallbackParameters_t * const pxCallback = &( xMessage.u.xCallbackParameters );
 
@@ -762,7 +1737,9 @@
                         configASSERT( pxCallback );
 
                         /* Call the function. */
+                        tmrEXIT_LIST_ACCESS();
                         pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
+                        tmrENTER_LIST_ACCESS();
                     }
                     else
                     {
@@ -797,7 +1774,7 @@
                  *  possibility of a higher priority task adding a message to the message
                  *  queue with a time that is ahead of the timer daemon task (because it
                  *  pre-empted the timer daemon task after the xTimeNow value was set). */
-                xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+                xTimeNow = prvSampleTimeNow( pxService, &xTimerListsWereSwitched );
 
                 switch( xMessage.xMessageID )
                 {
@@ -813,7 +1790,9 @@
                         {
                             /* The timer expired before it was added to the active
                              * timer list.  Process it now. */
+                            tmrEXIT_LIST_ACCESS();
                             pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                            tmrENTER_LIST_ACCESS();
                             traceTIMER_EXPIRED( pxTimer );
 
                             if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
@@ -887,110 +1866,218 @@
                 }
             }
         }
+
+        tmrEXIT_LIST_ACCESS();
     }
 /*-----------------------------------------------------------*/
 
-    static void prvSwitchTimerLists( void )
+    static void prvSwitchTimerLists( TimerService_t * const pxService )
     {
         TickType_t xNextExpireTime, xReloadTime;
-        List_t * pxTemp;
         Timer_t * pxTimer;
         BaseType_t xResult;
 
-        /* The tick count has overflowed.  The timer lists must be switched.
-         * If there are any timers still referenced from the current timer list
-         * then they must have expired and should be processed before the lists
-         * are switched. */
-        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
-        {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-
-            /* Remove the timer from the list. */
-            pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-            traceTIMER_EXPIRED( pxTimer );
+        #if ( configTIMER_USE_WHEEL == 1 )
+            {
+                BaseType_t xWheelWasEmpty;
 
-            /* Execute its callback, then send a command to restart the timer if
-             * it is an auto-reload timer.  It cannot be restarted here as the lists
-             * have not yet been switched. */
-            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                /* The tick count has overflowed, so every timer still in the
+                 * timing wheel has expired.  Process them in expiry time order
+                 * before the timers in the overflow list are moved into the
+                 * wheel. */
+                xNextExpireTime = prvWheelGetNextEvent( pxService, &xWheelWasEmpty );
 
-            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
-            {
-                /* Calculate the reload value, and if the reload value results in
-                 * the timer going into the same timer list then it has already expired
-                 * and the timer should be re-inserted into the current list so it is
-                 * processed again within this loop.  Otherwise a command should be sent
-                 * to restart the timer to ensure it is only inserted into a list after
-                 * the lists have been swapped. */
-                xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
-
-                if( xReloadTime > xNextExpireTime )
+                while( xWheelWasEmpty == pdFALSE )
                 {
-                    listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
-                    listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-                    vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                    if( prvWheelAdvance( pxService, xNextExpireTime ) != pdFALSE )
+                    {
+                        pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxService->xTimerWheel[ 0 ][ xNextExpireTime & tmrWHEEL_SLOT_MASK ] ) ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                        traceTIMER_EXPIRED( pxTimer );
+
+                        pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+
+                        if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+                        {
+                            /* As with the lists below, a reload time that has not
+                             * overflowed goes back into the wheel, otherwise the
+                             * timer is restarted by a command. */
+                            xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
+
+                            if( xReloadTime > xNextExpireTime )
+                            {
+                                listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
+                                listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+                                prvWheelInsertTimer( pxService, pxTimer );
+                            }
+                            else
+                            {
+                                xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+                                configASSERT( xResult );
+                                ( void ) xResult;
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xNextExpireTime = prvWheelGetNextEvent( pxService, &xWheelWasEmpty );
                 }
-                else
+
+                /* Start the wheel again from the beginning of the new tick count
+                 * period, and move the timers that expire in it into the wheel. */
+                pxService->xTimerWheelTime = ( TickType_t ) 0U;
+
+                while( listLIST_IS_EMPTY( pxService->pxOverflowTimerList ) == pdFALSE )
                 {
-                    xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-                    configASSERT( xResult );
-                    ( void ) xResult;
+                    pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxOverflowTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                    prvWheelInsertTimer( pxService, pxTimer );
                 }
             }
-            else
+        #else /* if ( configTIMER_USE_WHEEL == 1 ) */
             {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        }
+                List_t * pxTemp;
+
+                /* The tick count has overflowed.  The timer lists must be switched.
+                 * If there are any timers still referenced from the current timer list
+                 * then they must have expired and should be processed before the lists
+                 * are switched. */
+                while( listLIST_IS_EMPTY( pxService->pxCurrentTimerList ) == pdFALSE )
+                {
+                    xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+
+                    /* Remove the timer from the list. */
+                    pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                    traceTIMER_EXPIRED( pxTimer );
+
+                    /* Execute its callback, then send a command to restart the timer if
+                     * it is an auto-reload timer.  It cannot be restarted here as the lists
+                     * have not yet been switched. */
+                    pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+
+                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+                    {
+                        /* Calculate the reload value, and if the reload value results in
+                         * the timer going into the same timer list then it has already expired
+                         * and the timer should be re-inserted into the current list so it is
+                         * processed again within this loop.  Otherwise a command should be sent
+                         * to restart the timer to ensure it is only inserted into a list after
+                         * the lists have been swapped. */
+                        xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
+
+                        if( xReloadTime > xNextExpireTime )
+                        {
+                            listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
+                            listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+                            vListInsert( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                        }
+                        else
+                        {
+                            xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+                            configASSERT( xResult );
+                            ( void ) xResult;
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
 
-        pxTemp = pxCurrentTimerList;
-        pxCurrentTimerList = pxOverflowTimerList;
-        pxOverflowTimerList = pxTemp;
+                pxTemp = pxService->pxCurrentTimerList;
+                pxService->pxCurrentTimerList = pxService->pxOverflowTimerList;
+                pxService->pxOverflowTimerList = pxTemp;
+            }
+        #endif /* configTIMER_USE_WHEEL */
     }
 /*-----------------------------------------------------------*/
 
     static void prvCheckForValidListAndQueue( void )
     {
-        /* Check that the list from which active timers are referenced, and the
-         * queue used to communicate with the timer service, have been
+        UBaseType_t uxService;
+        TimerService_t * pxService;
+
+        /* Check that the lists from which active timers are referenced, and the
+         * queues used to communicate with the timer services, have been
          * initialised. */
         taskENTER_CRITICAL();
         {
-            if( xTimerQueue == NULL )
+            if( xTimerServices[ 0 ].xTimerQueue == NULL )
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
-                pxCurrentTimerList = &xActiveTimerList1;
-                pxOverflowTimerList = &xActiveTimerList2;
-
-                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                #if ( configUSE_FAST_TIMERS == 1 )
                     {
-                        /* The timer queue is allocated statically in case
-                         * configSUPPORT_DYNAMIC_ALLOCATION is 0. */
-                        PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueue;                                                                          /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
-                        PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
-
-                        xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
-                    }
-                #else
-                    {
-                        xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+                        vListInitialise( &xFastTimerList1 );
+                        vListInitialise( &xFastTimerList2 );
+                        pxCurrentFastTimerList = &xFastTimerList1;
+                        pxOverflowFastTimerList = &xFastTimerList2;
                     }
-                #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+                #endif /* configUSE_FAST_TIMERS */
 
-                #if ( configQUEUE_REGISTRY_SIZE > 0 )
-                    {
-                        if( xTimerQueue != NULL )
+                for( uxService = ( UBaseType_t ) 0U; uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT; uxService++ )
+                {
+                    pxService = &( xTimerServices[ uxService ] );
+
+                    vListInitialise( &( pxService->xActiveTimerList1 ) );
+                    vListInitialise( &( pxService->xActiveTimerList2 ) );
+                    pxService->pxCurrentTimerList = &( pxService->xActiveTimerList1 );
+                    pxService->pxOverflowTimerList = &( pxService->xActiveTimerList2 );
+                    pxService->xTimerTaskHandle = NULL;
+                    pxService->xLastTime = ( TickType_t ) 0U;
+
+                    #if ( configTIMER_USE_WHEEL == 1 )
                         {
-                            vQueueAddToRegistry( xTimerQueue, "TmrQ" );
+                            UBaseType_t uxLevel, uxSlot;
+
+                            for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) tmrWHEEL_LEVELS; uxLevel++ )
+                            {
+                                for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) tmrWHEEL_SLOTS; uxSlot++ )
+                                {
+                                    vListInitialise( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ) );
+                                }
+
+                                pxService->ulTimerWheelSlotsInUse[ uxLevel ] = 0UL;
+                            }
+
+                            pxService->xTimerWheelTime = ( TickType_t ) 0U;
                         }
-                        else
+                    #endif /* configTIMER_USE_WHEEL */
+
+                    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                         {
-                            mtCOVERAGE_TEST_MARKER();
+                            /* The timer queues are allocated statically in case
+                             * configSUPPORT_DYNAMIC_ALLOCATION is 0. */
+                            PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueues[ configTIMER_SERVICE_COUNT ];                                                                          /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+                            PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ configTIMER_SERVICE_COUNT ][ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+
+                            pxService->xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ uxService ][ 0 ] ), &( xStaticTimerQueues[ uxService ] ) );
                         }
-                    }
-                #endif /* configQUEUE_REGISTRY_SIZE */
+                    #else
+                        {
+                            pxService->xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+                        }
+                    #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+
+                    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+                        {
+                            if( pxService->xTimerQueue != NULL )
+                            {
+                                vQueueAddToRegistry( pxService->xTimerQueue, "TmrQ" );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #endif /* configQUEUE_REGISTRY_SIZE */
+                }
             }
             else
             {
@@ -1075,7 +2162,7 @@
             xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
             xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-            xReturn = xQueueSendFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+            xReturn = xQueueSendFromISR( xTimerServices[ 0 ].xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
 
             tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
@@ -1098,7 +2185,7 @@
             /* This function can only be called after a timer has been created or
              * after the scheduler has been started because, until then, the timer
              * queue does not exist. */
-            configASSERT( xTimerQueue );
+            configASSERT( xTimerServices[ 0 ].xTimerQueue );
 
             /* Complete the message with the function parameters and post it to the
              * daemon task. */
@@ -1107,7 +2194,7 @@
             xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
             xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-            xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+            xReturn = xQueueSendToBack( xTimerServices[ 0 ].xTimerQueue, &xMessage, xTicksToWait );
 
             tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 